@@ -4,21 +4,33 @@
 #include <vector>
 #include <algorithm>
 #include <cstdlib>
+#include <fstream>
+#include <memory>
 #include "lib/base/base_bot.h"
 #include "lib/engine/runner.h"
+#include "lib/eval/equity.h"
+#include "lib/eval/exact_equity.h"
 #include "lib/game/game_constants.h"
 #include "lib/game/game_state.h"
 #include "lib/game/poker_moves.h"
 #include "lib/game/round_state.h"
 #include "lib/game/terminal_state.h"
+#include "lib/solver/blueprint.h"
 
 class PokerStrategy : public BaseBot {
 private:
     std::mt19937 rng;
     std::uniform_real_distribution<double> dist;
+    EquityCalculator equityCalculator;
+    ExactEquity exactEquity;
+    std::unique_ptr<Blueprint> blueprint;
 
 public:
-    PokerStrategy() : rng(std::random_device()()), dist(0.0, 1.0) {}
+    PokerStrategy() : rng(std::random_device()()), dist(0.0, 1.0) {
+        if (std::ifstream("blueprint.bin").good()) {
+            blueprint = std::make_unique<Blueprint>("blueprint.bin", "abstraction");
+        }
+    }
 
     void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) override {
     }
@@ -31,12 +43,27 @@ public:
         }
     }
 
-    PokerMove getAction(const GameState& gameState, const RoundState& roundState, int active) override {
-        auto legalActions = roundState.getLegalActions();
+    // getAction offers check/fold before computing and bounds its sampling
+    // by the deadline, so the client may cut it off there.
+    bool isAnytime() const override {
+        return true;
+    }
+
+    // The client ponders on a single thread by default, and never alongside
+    // the other callbacks, so getAction can double as ponder() unchanged.
+    bool canPonder() const override {
+        return true;
+    }
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active) override {
+        DecisionContext unbounded;
+        return getAction(gameState, roundState, active, unbounded);
+    }
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active,
+                   DecisionContext& context) override {
+        ActionOptions options = roundState.getActionOptions();
         int street = roundState.getStreet();
-        const auto& myCards = roundState.getHands()[active];
-        std::vector<std::string> boardCards(roundState.getDeck().begin(), 
-                                           roundState.getDeck().begin() + street);
         int myPip = roundState.getPips()[active];
         int oppPip = roundState.getPips()[1 - active];
         int myStack = roundState.getStacks()[active];
@@ -44,36 +71,99 @@ public:
         int continueCost = oppPip - myPip;
         std::string myBounty = roundState.getBounties()[active];
 
-        if (legalActions.find(PokerMove::Type::RAISE) != legalActions.end()) {
-            auto raiseBounds = roundState.getRaiseBounds();
-            if (dist(rng) < 0.4) {
-                return RaiseAction(raiseBounds[0]);
+        if (blueprint) {
+            BettingAbstraction::Action actions[BettingAbstraction::NUM_ACTIONS];
+            float probabilities[BettingAbstraction::NUM_ACTIONS];
+            int count = blueprint->getStrategy(roundState, active, actions, probabilities);
+            if (count > 0) {
+                double sample = dist(rng);
+                BettingAbstraction::Action action = actions[count - 1];
+                for (int i = 0; i < count; i++) {
+                    sample -= probabilities[i];
+                    if (sample < 0.0) {
+                        action = actions[i];
+                        break;
+                    }
+                }
+                if (action == BettingAbstraction::FOLD) {
+                    return Move::fold();
+                }
+                if (action == BettingAbstraction::CHECK_CALL) {
+                    if (continueCost == 0) {
+                        return Move::check();
+                    }
+                    return Move::call();
+                }
+                return Move::raise(BettingState::fromRoundState(roundState).getRaiseAmount(action));
             }
         }
 
-        if (legalActions.find(PokerMove::Type::CHECK) != legalActions.end()) {
-            return CheckAction();
+        Move safe = options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::fold();
+        if (context.isPanic()) {
+            return safe;
         }
+        context.offer(safe);
+
+        // Enumerating a flop takes about as long as a flop decision's budget,
+        // so the flop is sampled up to the deadline like preflop; turn and
+        // river enumeration is cheap.
+        double equity;
+        if (street >= 4) {
+            equity = exactEquity.vsRange(roundState, active, ComboWeights()).getEquity();
+        } else {
+            EquityOptions options;
+            options.deadline = context.getDeadline();
+            options.targetStdError = 0.01;
+            equity = equityCalculator.estimate(roundState, active, ComboWeights(), options).getEquity();
+        }
+        int pot = 2 * GameConstants::STARTING_STACK - myStack - oppStack;
+        double potOdds = continueCost / static_cast<double>(pot + continueCost);
 
-        if (dist(rng) < 0.2) {
-            return FoldAction();
+        if (options.legal.contains(PokerMove::Type::RAISE)) {
+            if (equity > 0.7 || (equity > 0.55 && dist(rng) < 0.3)) {
+                return Move::raise(options.raiseBounds[0]);
+            }
         }
 
-        return CallAction();
+        if (options.legal.contains(PokerMove::Type::CHECK)) {
+            return Move::check();
+        }
+
+        if (equity < potOdds) {
+            return Move::fold();
+        }
+
+        return Move::call();
     }
 };
 
-bool parseArgs(int argc, char* argv[], std::string& host, int& port) {
-    host = "localhost";
-    port = 0;
-
+bool parseArgs(int argc, char* argv[], Runner::ConnectionOptions& options) {
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
         if (arg == "--host" && i + 1 < argc) {
-            host = argv[++i];
+            options.host = argv[++i];
+        } else if (arg == "--unix" && i + 1 < argc) {
+            options.kind = Runner::ConnectionOptions::Kind::UNIX_SOCKET;
+            options.socketPath = argv[++i];
+        } else if (arg == "--shm" && i + 1 < argc) {
+            options.kind = Runner::ConnectionOptions::Kind::SHARED_MEMORY;
+            options.shmName = argv[++i];
+        } else if (arg == "--pipe") {
+            options.kind = Runner::ConnectionOptions::Kind::PIPE;
+        } else if (arg == "--fds" && i + 1 < argc) {
+            std::string fds = argv[++i];
+            std::size_t comma = fds.find(',');
+            try {
+                options.kind = Runner::ConnectionOptions::Kind::PIPE;
+                options.readFd = std::stoi(fds.substr(0, comma));
+                options.writeFd = comma == std::string::npos ? options.readFd : std::stoi(fds.substr(comma + 1));
+            } catch (const std::exception& e) {
+                std::cerr << "Invalid file descriptors: " << fds << std::endl;
+                return false;
+            }
         } else {
             try {
-                port = std::stoi(arg);
+                options.port = std::stoi(arg);
             } catch (const std::exception& e) {
                 std::cerr << "Invalid port: " << arg << std::endl;
                 return false;
@@ -81,7 +171,7 @@ bool parseArgs(int argc, char* argv[], std::string& host, int& port) {
         }
     }
 
-    if (port == 0) {
+    if (options.kind == Runner::ConnectionOptions::Kind::TCP && options.port == 0) {
         std::cerr << "Port is required" << std::endl;
         return false;
     }
@@ -90,14 +180,13 @@ bool parseArgs(int argc, char* argv[], std::string& host, int& port) {
 }
 
 int main(int argc, char* argv[]) {
-    std::string host;
-    int port;
+    Runner::ConnectionOptions options;
 
-    if (!parseArgs(argc, argv, host, port)) {
+    if (!parseArgs(argc, argv, options)) {
         return 1;
     }
 
     PokerStrategy strategy;
-    Runner::runBot(&strategy, host, port);
+    Runner::runBot(&strategy, options);
     return 0;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #define BASE_BOT_H
 
 #include "../game/poker_moves.h"
+#include "decision_context.h"
 #include "../game/game_state.h"
 #include "../game/round_state.h"
 #include "../game/terminal_state.h"
@@ -11,7 +12,37 @@ public:
     virtual ~BaseBot() = default;
     virtual void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) = 0;
     virtual void handleRoundOver(const GameState& gameState, const TerminalState& terminalState, int active) = 0;
-    virtual PokerMove getAction(const GameState& gameState, const RoundState& roundState, int active) = 0;
+    virtual Move getAction(const GameState& gameState, const RoundState& roundState, int active) = 0;
+
+    // Anytime variant used by the engine client. Strategies that can refine
+    // their answer override this, stop once context.shouldStop(), and offer
+    // intermediate moves to the context. Defaults to the blocking call.
+    virtual Move getAction(const GameState& gameState, const RoundState& roundState, int active,
+                           DecisionContext& context) {
+        return getAction(gameState, roundState, active);
+    }
+
+    // Opts in to deadline enforcement: the engine client runs getAction on
+    // a worker thread and, if it is not done shortly after the deadline,
+    // cancels it and sends the best move offered so far (or check/fold).
+    // Only for bots that offer a move early and honour shouldStop(); the
+    // rest run on the client thread and always have their move sent.
+    virtual bool isAnytime() const {
+        return false;
+    }
+
+    // Opts in to pondering: while the opponent thinks, the engine client
+    // calls ponder() for the states its likely replies would lead to. Ponder
+    // calls run on background threads, concurrently with each other when the
+    // client uses more than one, but never alongside the other callbacks.
+    virtual bool canPonder() const {
+        return false;
+    }
+
+    virtual Move ponder(const GameState& gameState, const RoundState& roundState, int active,
+                        DecisionContext& context) {
+        return getAction(gameState, roundState, active, context);
+    }
 };
 
 #endif
@@ -0,0 +1,86 @@
+#ifndef DECISION_CONTEXT_H
+#define DECISION_CONTEXT_H
+
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+#include "../game/poker_moves.h"
+
+// Deadline, cancellation flag and best-so-far answer for one anytime
+// decision. The strategy polls shouldStop() between units of work and
+// offers its current best move as it improves; if it overruns, the engine
+// client cancels it and sends that move (or a safe fallback) instead.
+class DecisionContext {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    Clock::time_point deadline;
+    bool panic;
+    std::atomic<bool> cancelled;
+    std::atomic<bool> offered;
+    std::atomic<Move> best;
+
+    static_assert(std::is_trivially_copyable_v<Move>, "Move must stay trivially copyable");
+
+public:
+    DecisionContext() : deadline(Clock::time_point::max()), panic(false), cancelled(false), offered(false),
+                        best(Move::fold()) {}
+
+    DecisionContext(const DecisionContext&) = delete;
+    DecisionContext& operator=(const DecisionContext&) = delete;
+
+    // Starts a new decision. Only call while no strategy is using the context.
+    void reset(Clock::time_point newDeadline, bool newPanic) {
+        deadline = newDeadline;
+        panic = newPanic;
+        cancelled.store(false, std::memory_order_relaxed);
+        offered.store(false, std::memory_order_relaxed);
+    }
+
+    Clock::time_point getDeadline() const {
+        return deadline;
+    }
+
+    // Seconds left before the deadline, never negative.
+    double getRemaining() const {
+        if (deadline == Clock::time_point::max()) {
+            return std::chrono::duration<double>::max().count();
+        }
+        double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+        return remaining > 0.0 ? remaining : 0.0;
+    }
+
+    // The game clock is nearly spent; answer from the cheapest policy.
+    bool isPanic() const {
+        return panic;
+    }
+
+    bool isCancelled() const {
+        return cancelled.load(std::memory_order_relaxed);
+    }
+
+    bool shouldStop() const {
+        return isCancelled() || Clock::now() >= deadline;
+    }
+
+    void cancel() {
+        cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    // Records the best move found so far.
+    void offer(Move move) {
+        best.store(move, std::memory_order_relaxed);
+        offered.store(true, std::memory_order_release);
+    }
+
+    bool hasBest() const {
+        return offered.load(std::memory_order_acquire);
+    }
+
+    Move getBest() const {
+        return best.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef TIME_BUDGET_H
+#define TIME_BUDGET_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include "../game/game_constants.h"
+#include "../game/game_state.h"
+
+// Tuning for TimeBudget; all times are in seconds.
+struct TimeBudgetOptions {
+    // Seconds never handed out, covering engine overhead and jitter.
+    double reserve = 1.0;
+    // Below this much usable clock, every decision is a panic decision.
+    double panicThreshold = 2.0;
+    // Overhead per remaining round that is not spent in getAction.
+    double roundOverhead = 0.0005;
+    // Relative weights for preflop, flop, turn and river.
+    std::array<double, 4> streetWeights = {0.5, 1.0, 1.2, 1.8};
+    // No single decision gets more than this, nor more than
+    // maxClockFraction of the usable clock.
+    double maxDecision = 2.0;
+    double maxClockFraction = 0.1;
+    // Allowances below this are not worth thinking with.
+    double minDecision = 0.0002;
+};
+
+// Splits the remaining game clock into per-decision allowances. The clock is
+// shared by all NUM_ROUNDS rounds, so each decision gets the fair share of
+// what is left, scaled by street: cheap preflop spots spend less than
+// their share so river spots can spend more. Near the end of the clock the
+// budget drops to panic mode, where bots should answer from their fastest
+// policy.
+class TimeBudget {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    TimeBudgetOptions options;
+    double decisionsPerRound;
+
+    static int roundOfStreet(int street) {
+        return street == 0 ? 0 : std::clamp(street - 2, 1, 3);
+    }
+
+    double usableClock(const GameState& gameState) const {
+        int remainingRounds = std::max(1, GameConstants::NUM_ROUNDS - gameState.getRoundNum() + 1);
+        return gameState.getGameClock() - options.reserve - remainingRounds * options.roundOverhead;
+    }
+
+public:
+    explicit TimeBudget(TimeBudgetOptions options = TimeBudgetOptions()) : options(options), decisionsPerRound(3.0) {}
+
+    const TimeBudgetOptions& getOptions() const {
+        return options;
+    }
+
+    // Expected number of getAction calls per round, learned from play.
+    double getDecisionsPerRound() const {
+        return decisionsPerRound;
+    }
+
+    // Feeds back how many decisions the last round took.
+    void observeRound(int decisions) {
+        decisionsPerRound = std::max(1.0, 0.98 * decisionsPerRound + 0.02 * decisions);
+    }
+
+    bool isPanic(const GameState& gameState) const {
+        return usableClock(gameState) < options.panicThreshold;
+    }
+
+    // Seconds this decision may take; 0 in panic mode.
+    double allocate(const GameState& gameState, int street) const {
+        double usable = usableClock(gameState);
+        if (usable < options.panicThreshold) {
+            return 0.0;
+        }
+        int remainingRounds = std::max(1, GameConstants::NUM_ROUNDS - gameState.getRoundNum() + 1);
+        double fairShare = usable / (remainingRounds * decisionsPerRound);
+        double seconds = fairShare * options.streetWeights[roundOfStreet(street)];
+        seconds = std::min({seconds, options.maxDecision, usable * options.maxClockFraction});
+        return seconds < options.minDecision ? 0.0 : seconds;
+    }
+
+    // Deadline for a decision that starts now.
+    Clock::time_point deadline(const GameState& gameState, int street) const {
+        return Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(allocate(gameState, street)));
+    }
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef DECISION_WORKER_H
+#define DECISION_WORKER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "../game/poker_moves.h"
+
+// One long-lived thread that runs a single decision at a time, so the engine
+// client can stop waiting at a deadline without killing the computation. A
+// job that overruns keeps running in the background; start() and waitIdle()
+// wait for it before anything else touches the bot.
+class DecisionWorker {
+private:
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    std::function<Move()> job;
+    bool pending;
+    bool busy;
+    bool stopping;
+    Move result;
+    std::exception_ptr error;
+
+    void loop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [this]() { return pending || stopping; });
+            if (stopping) {
+                return;
+            }
+            pending = false;
+            std::function<Move()> current = std::move(job);
+            lock.unlock();
+            Move move;
+            std::exception_ptr thrown;
+            try {
+                move = current();
+            } catch (...) {
+                thrown = std::current_exception();
+            }
+            lock.lock();
+            result = move;
+            error = thrown;
+            busy = false;
+            finished.notify_all();
+        }
+    }
+
+public:
+    DecisionWorker() : pending(false), busy(false), stopping(false), result(Move::fold()) {
+        thread = std::thread([this]() { loop(); });
+    }
+
+    DecisionWorker(const DecisionWorker&) = delete;
+    DecisionWorker& operator=(const DecisionWorker&) = delete;
+
+    ~DecisionWorker() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [this]() { return !busy; });
+            stopping = true;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+
+    void start(std::function<Move()> next) {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return !busy; });
+        job = std::move(next);
+        pending = true;
+        busy = true;
+        error = nullptr;
+        wake.notify_one();
+    }
+
+    // Waits for the current job until the deadline. Returns false if it is
+    // still running; otherwise sets move, rethrowing anything the job threw.
+    bool waitUntil(std::chrono::steady_clock::time_point deadline, Move& move) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!finished.wait_until(lock, deadline, [this]() { return !busy; })) {
+            return false;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        move = result;
+        return true;
+    }
+
+    void waitIdle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return !busy; });
+    }
+};
+
+#endif
@@ -2,221 +2,293 @@
 #define ENGINE_CLIENT_H
 
 #include <array>
-#include <iostream>
+#include <cassert>
+#include <chrono>
 #include <memory>
-#include <sstream>
 #include <string>
-#include <vector>
+#include <string_view>
 #include <variant>
 #include "../base/base_bot.h"
+#include "../base/decision_context.h"
+#include "../base/time_budget.h"
+#include "../game/card.h"
 #include "../game/game_constants.h"
 #include "../game/game_state.h"
 #include "../game/poker_moves.h"
 #include "../game/round_state.h"
 #include "../game/terminal_state.h"
+#include "decision_worker.h"
+#include "ponderer.h"
+#include "protocol.h"
+#include "transport.h"
 
 class EngineClient {
 private:
     BaseBot& pokerbot;
-    std::istream& in;
-    std::ostream& out;
+    Transport& transport;
+    ReceiveBuffer buffer;
 
-public:
-    EngineClient(BaseBot& pokerbot, std::istream& in, std::ostream& out)
-        : pokerbot(pokerbot), in(in), out(out) {}
-
-    void send(const PokerMove& action) {
-        std::string code;
-        switch (action.getType()) {
-            case PokerMove::Type::FOLD:
-                code = "F";
+    GameState gameState;
+    std::shared_ptr<RoundState> roundState;
+    int active;
+    bool roundFlag;
+    int lastDelta;
+
+    TimeBudget timeBudget;
+    DecisionContext context;
+    std::unique_ptr<DecisionWorker> worker;
+    std::unique_ptr<Ponderer> ponderer;
+    std::chrono::steady_clock::duration grace;
+    // When the message now being handled was taken off the transport; the
+    // engine's clock for the reply runs from about then.
+    std::chrono::steady_clock::time_point received;
+    int decisions;
+
+    void replaceState(const Board& deck, const std::array<std::string, 2>& bounties) {
+        roundState = std::make_shared<RoundState>(
+            roundState->getButton(), roundState->getStreet(),
+            roundState->getPips(), roundState->getStacks(),
+            roundState->getHands(), bounties, deck,
+            roundState->getPreviousState()
+        );
+    }
+
+    // Applies one engine event; returns false on quit.
+    bool handle(const Protocol::Event& event) {
+        switch (event.type) {
+            case Protocol::EventType::TIME:
+                gameState = GameState(gameState.getBankroll(), event.time, gameState.getRoundNum());
                 break;
-            case PokerMove::Type::CALL:
-                code = "C";
+            case Protocol::EventType::PLAYER:
+                active = event.value;
                 break;
-            case PokerMove::Type::CHECK:
-                code = "K";
+            case Protocol::EventType::HAND: {
+                std::array<Hand, 2> hands;
+                hands[active] = event.hand;
+                std::array<int, 2> pips = {GameConstants::SMALL_BLIND, GameConstants::BIG_BLIND};
+                std::array<int, 2> stacks = {
+                    GameConstants::STARTING_STACK - GameConstants::SMALL_BLIND,
+                    GameConstants::STARTING_STACK - GameConstants::BIG_BLIND
+                };
+                std::array<std::string, 2> bounties = {"-1", "-1"};
+                roundState = std::make_shared<RoundState>(0, 0, pips, stacks, hands, bounties,
+                                                        Board(), nullptr);
+                break;
+            }
+            case Protocol::EventType::BOUNTY:
+                if (roundState) {
+                    std::array<std::string, 2> bounties = roundState->getBounties();
+                    bounties[active] = std::string(1, event.bountyRank);
+                    replaceState(roundState->getDeck(), bounties);
+                    if (roundFlag) {
+                        stopPondering();
+                        pokerbot.handleNewRound(gameState, *roundState, active);
+                        roundFlag = false;
+                    }
+                }
                 break;
-            case PokerMove::Type::RAISE:
-                code = "R" + std::to_string(action.getAmount());
+            case Protocol::EventType::ACTION:
+                if (roundState) {
+                    auto result = roundState->proceed(event.move);
+                    if (std::holds_alternative<std::shared_ptr<RoundState>>(result)) {
+                        roundState = std::get<std::shared_ptr<RoundState>>(result);
+                    }
+                }
+                break;
+            case Protocol::EventType::BOARD:
+                if (roundState) {
+                    replaceState(event.board, roundState->getBounties());
+                }
+                break;
+            case Protocol::EventType::OPPONENT_HAND:
+                if (roundState && roundState->getPreviousState()) {
+                    auto prevState = roundState->getPreviousState();
+                    auto hands = prevState->getHands();
+                    hands[1 - active] = event.hand;
+                    roundState = std::make_shared<RoundState>(
+                        prevState->getButton(), prevState->getStreet(),
+                        prevState->getPips(), prevState->getStacks(),
+                        hands, prevState->getBounties(), prevState->getDeck(),
+                        prevState->getPreviousState()
+                    );
+                }
+                break;
+            case Protocol::EventType::DELTA:
+                if (roundState) {
+                    lastDelta = event.value;
+                    gameState = GameState(gameState.getBankroll() + event.value,
+                                        gameState.getGameClock(), gameState.getRoundNum());
+                }
                 break;
+            case Protocol::EventType::BOUNTY_HITS:
+                if (roundState) {
+                    bool heroHitBounty = event.bountyHits[0];
+                    bool opponentHitBounty = event.bountyHits[1];
+                    std::array<bool, 2> bountyHits = active == 1 ?
+                        std::array<bool, 2>{opponentHitBounty, heroHitBounty} :
+                        std::array<bool, 2>{heroHitBounty, opponentHitBounty};
+                    std::array<int, 2> deltas = {-lastDelta, -lastDelta};
+                    deltas[active] = lastDelta;
+                    auto terminalState = TerminalState(deltas, &bountyHits, roundState);
+                    stopPondering();
+                    pokerbot.handleRoundOver(gameState, terminalState, active);
+                    timeBudget.observeRound(decisions);
+                    decisions = 0;
+                    gameState = GameState(gameState.getBankroll(), gameState.getGameClock(),
+                                        gameState.getRoundNum() + 1);
+                    roundFlag = true;
+                    lastDelta = 0;
+                }
+                break;
+            case Protocol::EventType::QUIT:
+                return false;
         }
-        out << code << std::endl;
+        return true;
     }
 
-    void run() {
-        GameState gameState(0, 0.0, 1);
-        std::shared_ptr<RoundState> roundState = nullptr;
-        int active = 0;
-        bool roundFlag = true;
-
-        std::string line;
-        while (std::getline(in, line)) {
-            std::istringstream iss(line);
-            std::string clause;
-            while (iss >> clause) {
-                if (clause.empty()) {
-                    continue;
-                }
+    static bool isLegal(const RoundState& state, Move move) {
+        const ActionOptions options = state.getActionOptions();
+        bool inBounds = move.getType() != PokerMove::Type::RAISE ||
+                        (move.getAmount() >= options.raiseBounds[0] && move.getAmount() <= options.raiseBounds[1]);
+        return options.legal.contains(move.getType()) && inBounds;
+    }
 
-                char firstChar = clause[0];
-                std::string rest = clause.substr(1);
+    static Move fallback(const RoundState& state, const DecisionContext& context) {
+        if (context.hasBest() && isLegal(state, context.getBest())) {
+            return context.getBest();
+        }
+        return state.getActionOptions().legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::fold();
+    }
 
-                switch (firstChar) {
-                    case 'T': {
-                        double time = std::stod(rest);
-                        gameState = GameState(gameState.getBankroll(), time, gameState.getRoundNum());
-                        break;
-                    }
-                    case 'P': {
-                        active = static_cast<int>(std::stod(rest));
-                        break;
-                    }
-                    case 'H': {
-                        std::array<std::vector<std::string>, 2> hands;
-                        std::istringstream handStream(rest);
-                        std::string card;
-                        while (std::getline(handStream, card, ',')) {
-                            hands[active].push_back(card);
-                        }
-                        std::array<int, 2> pips = {GameConstants::SMALL_BLIND, GameConstants::BIG_BLIND};
-                        std::array<int, 2> stacks = {
-                            GameConstants::STARTING_STACK - GameConstants::SMALL_BLIND,
-                            GameConstants::STARTING_STACK - GameConstants::BIG_BLIND
-                        };
-                        std::array<std::string, 2> bounties = {"-1", "-1"};
-                        roundState = std::make_shared<RoundState>(0, 0, pips, stacks, hands, bounties, 
-                                                                std::vector<std::string>(), nullptr);
-                        break;
-                    }
-                    case 'G': {
-                        if (roundState) {
-                            std::array<std::string, 2> bounties = roundState->getBounties();
-                            bounties[active] = rest;
-                            roundState = std::make_shared<RoundState>(
-                                roundState->getButton(), roundState->getStreet(),
-                                roundState->getPips(), roundState->getStacks(),
-                                roundState->getHands(), bounties, roundState->getDeck(),
-                                roundState->getPreviousState()
-                            );
-                            if (roundFlag) {
-                                pokerbot.handleNewRound(gameState, *roundState, active);
-                                roundFlag = false;
-                            }
-                        }
-                        break;
-                    }
-                    case 'F': {
-                        if (roundState) {
-                            auto result = roundState->proceed(FoldAction());
-                            if (std::holds_alternative<std::shared_ptr<RoundState>>(result)) {
-                                roundState = std::get<std::shared_ptr<RoundState>>(result);
-                            }
-                        }
-                        break;
-                    }
-                    case 'C': {
-                        if (roundState) {
-                            auto result = roundState->proceed(CallAction());
-                            if (std::holds_alternative<std::shared_ptr<RoundState>>(result)) {
-                                roundState = std::get<std::shared_ptr<RoundState>>(result);
-                            }
-                        }
-                        break;
-                    }
-                    case 'K': {
-                        if (roundState) {
-                            auto result = roundState->proceed(CheckAction());
-                            if (std::holds_alternative<std::shared_ptr<RoundState>>(result)) {
-                                roundState = std::get<std::shared_ptr<RoundState>>(result);
-                            }
-                        }
-                        break;
-                    }
-                    case 'R': {
-                        if (roundState) {
-                            int amount = std::stoi(rest);
-                            auto result = roundState->proceed(RaiseAction(amount));
-                            if (std::holds_alternative<std::shared_ptr<RoundState>>(result)) {
-                                roundState = std::get<std::shared_ptr<RoundState>>(result);
-                            }
-                        }
-                        break;
-                    }
-                    case 'B': {
-                        if (roundState) {
-                            std::vector<std::string> deck;
-                            std::istringstream deckStream(rest);
-                            std::string card;
-                            while (std::getline(deckStream, card, ',')) {
-                                deck.push_back(card);
-                            }
-                            roundState = std::make_shared<RoundState>(
-                                roundState->getButton(), roundState->getStreet(),
-                                roundState->getPips(), roundState->getStacks(),
-                                roundState->getHands(), roundState->getBounties(), deck,
-                                roundState->getPreviousState()
-                            );
-                        }
-                        break;
-                    }
-                    case 'O': {
-                        if (roundState && roundState->getPreviousState()) {
-                            auto prevState = roundState->getPreviousState();
-                            auto hands = prevState->getHands();
-                            std::istringstream handStream(rest);
-                            std::string card;
-                            hands[1 - active].clear();
-                            while (std::getline(handStream, card, ',')) {
-                                hands[1 - active].push_back(card);
-                            }
-                            auto newState = std::make_shared<RoundState>(
-                                prevState->getButton(), prevState->getStreet(),
-                                prevState->getPips(), prevState->getStacks(),
-                                hands, prevState->getBounties(), prevState->getDeck(),
-                                prevState->getPreviousState()
-                            );
-                            roundState = newState;
-                        }
-                        break;
-                    }
-                    case 'D': {
-                        if (roundState) {
-                            int delta = std::stoi(rest);
-                            std::array<int, 2> deltas = {-delta, -delta};
-                            deltas[active] = delta;
-                            gameState = GameState(gameState.getBankroll() + delta,
-                                                gameState.getGameClock(), gameState.getRoundNum());
-                        }
-                        break;
-                    }
-                    case 'Y': {
-                        if (roundState) {
-                            bool heroHitBounty = rest[0] == '1';
-                            bool opponentHitBounty = rest[1] == '1';
-                            std::array<bool, 2> bountyHits = active == 1 ?
-                                std::array<bool, 2>{opponentHitBounty, heroHitBounty} :
-                                std::array<bool, 2>{heroHitBounty, opponentHitBounty};
-                            auto terminalState = TerminalState(std::array<int, 2>{0, 0}, &bountyHits, roundState);
-                            pokerbot.handleRoundOver(gameState, terminalState, active);
-                            gameState = GameState(gameState.getBankroll(), gameState.getGameClock(),
-                                                gameState.getRoundNum() + 1);
-                            roundFlag = true;
-                        }
-                        break;
-                    }
-                    case 'Q': {
-                        return;
-                    }
+    void stopPondering() {
+        if (ponderer) {
+            ponderer->finish();
+        }
+    }
+
+    // Speculates on the opponent's reply to action while waiting for it.
+    void startPondering(Move action) {
+        if (!ponderer || !isLegal(*roundState, action)) {
+            return;
+        }
+        // After a timeout the abandoned getAction may still be running, and
+        // ponder() must not run alongside it.
+        if (worker) {
+            worker->waitIdle();
+        }
+        ponderer->start(pokerbot, gameState, *roundState, action, active, [this](const RoundState& predicted) {
+            return timeBudget.allocate(gameState, predicted.getStreet());
+        });
+    }
+
+    // Asks the bot for a move within the time budget, counted from when
+    // the message arrived so that time spent waiting for a cancelled
+    // decision to unwind comes out of it. With enforcement on, the bot runs
+    // on the worker thread; if it is not done a grace period after its
+    // deadline it is cancelled and the best-so-far move is sent.
+    Move decide() {
+        decisions++;
+        const double budget = timeBudget.allocate(gameState, roundState->getStreet());
+        context.reset(received + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(budget)),
+                      timeBudget.isPanic(gameState));
+        if (ponderer) {
+            // Without enforcement the bot's own answer is always awaited.
+            const auto waitUntil = worker ? context.getDeadline() + grace : std::chrono::steady_clock::time_point::max();
+            Move pondered;
+            const Ponderer::Take taken = ponderer->take(*roundState, waitUntil, pondered);
+            if (taken == Ponderer::Take::READY && isLegal(*roundState, pondered)) {
+                return pondered;
+            }
+            // The matching job is this same decision, started earlier, and
+            // it has used the whole budget. Starting over on the spent
+            // deadline could only fall back as well, after waiting for the
+            // job to unwind. Sending the fallback (always legal) restarts
+            // pondering, which finishes the job.
+            if (taken == Ponderer::Take::OVERRAN) {
+                return fallback(*roundState, context);
+            }
+            ponderer->finish();
+        }
+        if (!worker) {
+            return pokerbot.getAction(gameState, *roundState, active, context);
+        }
+
+        std::shared_ptr<RoundState> state = roundState;
+        GameState game = gameState;
+        int player = active;
+        worker->start([this, state, game, player]() { return pokerbot.getAction(game, *state, player, context); });
+        Move action;
+        if (worker->waitUntil(context.getDeadline() + grace, action)) {
+            return action;
+        }
+        context.cancel();
+        return fallback(*state, context);
+    }
+
+public:
+    EngineClient(BaseBot& pokerbot, Transport& transport, TimeBudgetOptions budgetOptions = TimeBudgetOptions())
+        : pokerbot(pokerbot), transport(transport), buffer(), gameState(0, 0.0, 1), roundState(nullptr),
+          active(0), roundFlag(true), lastDelta(0), timeBudget(budgetOptions), context(),
+          worker(pokerbot.isAnytime() ? std::make_unique<DecisionWorker>() : nullptr),
+          ponderer(pokerbot.canPonder() ? std::make_unique<Ponderer>() : nullptr),
+          grace(std::chrono::milliseconds(5)), received(), decisions(0) {}
+
+    ~EngineClient() {
+        stopPondering();
+    }
+
+    // Enforcement is on by default for bots whose isAnytime() is true. It
+    // costs a thread handoff per decision; bots that always answer quickly
+    // can turn it off and run on the client thread.
+    void setDeadlineEnforcement(bool enabled, std::chrono::steady_clock::duration graceTime = std::chrono::milliseconds(5)) {
+        if (worker) {
+            worker->waitIdle();
+        }
+        worker = enabled ? std::make_unique<DecisionWorker>() : nullptr;
+        grace = graceTime;
+    }
+
+    // Number of ponder threads; 0 turns pondering off. Only takes effect for
+    // bots whose canPonder() is true.
+    void setPondering(unsigned numThreads) {
+        stopPondering();
+        ponderer = numThreads > 0 && pokerbot.canPonder() ? std::make_unique<Ponderer>(numThreads) : nullptr;
+    }
+
+    // One write per decision: the code and its newline go out together.
+    void send(Move action) {
+        char message[16];
+        std::size_t length = action.encodeTo(message);
+        message[length++] = '\n';
+        transport.send(message, length);
+    }
+
+    void run() {
+        std::string_view line;
+        while (true) {
+            while (!buffer.nextLine(line)) {
+                if (!buffer.fill(transport)) {
+                    return;
                 }
             }
+            received = std::chrono::steady_clock::now();
+            // A cancelled decision may still be unwinding; the bot is not
+            // reentrant, so let it finish before delivering more events.
+            if (worker) {
+                worker->waitIdle();
+            }
+            if (!Protocol::parseMessage(line, [this](const Protocol::Event& event) { return handle(event); })) {
+                return;
+            }
 
             if (roundFlag) {
-                send(CheckAction());
+                send(Move::check());
             } else if (roundState) {
                 assert(active == roundState->getButton() % 2);
-                PokerMove action = pokerbot.getAction(gameState, *roundState, active);
+                Move action = decide();
                 send(action);
+                startPondering(action);
             }
         }
     }
@@ -0,0 +1,171 @@
+#ifndef PONDERER_H
+#define PONDERER_H
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <variant>
+#include <vector>
+#include "../base/base_bot.h"
+#include "../base/decision_context.h"
+#include "../game/game_state.h"
+#include "../game/legal_actions.h"
+#include "../game/poker_moves.h"
+#include "../game/round_state.h"
+#include "../util/thread_pool.h"
+
+// Speculative decisions computed while the opponent thinks. After the bot
+// acts, each opponent reply that leaves the bot to act again on the same
+// street (no unseen cards) is handed to BaseBot::ponder on the pool. When
+// the real reply arrives, a finished match is used as is and the rest are
+// cancelled.
+class Ponderer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Job {
+        std::shared_ptr<RoundState> predicted;
+        std::unique_ptr<DecisionContext> context;
+        std::future<Move> result;
+    };
+
+    ThreadPool pool;
+    std::vector<Job> jobs;
+
+    static bool samePosition(const RoundState& a, const RoundState& b) {
+        return a.getStreet() == b.getStreet() && a.getButton() == b.getButton() && a.getPips() == b.getPips() &&
+               a.getStacks() == b.getStacks();
+    }
+
+    static std::shared_ptr<RoundState> after(const RoundState& state, Move move) {
+        auto next = state.proceed(move);
+        if (!std::holds_alternative<std::shared_ptr<RoundState>>(next)) {
+            return nullptr;
+        }
+        return std::get<std::shared_ptr<RoundState>>(next);
+    }
+
+    // Opponent replies worth preparing for: check or call, plus a minimum,
+    // pot-sized and all-in raise.
+    static std::vector<Move> likelyReplies(const RoundState& state, int opponent) {
+        const ActionOptions options = state.getActionOptions();
+        std::vector<Move> replies;
+        replies.push_back(options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::call());
+        if (options.legal.contains(PokerMove::Type::RAISE)) {
+            const std::array<int, 2>& pips = state.getPips();
+            const std::array<int, 2>& stacks = state.getStacks();
+            int pot = 2 * GameConstants::STARTING_STACK - stacks[0] - stacks[1];
+            int potRaise = pips[1 - opponent] + pot + (pips[1 - opponent] - pips[opponent]);
+            for (int amount : {options.raiseBounds[0], std::clamp(potRaise, options.raiseBounds[0], options.raiseBounds[1]),
+                               options.raiseBounds[1]}) {
+                if (std::none_of(replies.begin(), replies.end(), [&](Move move) { return move.getAmount() == amount; })) {
+                    replies.push_back(Move::raise(amount));
+                }
+            }
+        }
+        return replies;
+    }
+
+public:
+    enum class Take {
+        // Nothing pondered this position.
+        NO_MATCH,
+        // The pondered decision, or the move its job offered, is ready.
+        READY,
+        // The matching job was still running at the deadline and had
+        // offered nothing.
+        OVERRAN
+    };
+
+    explicit Ponderer(unsigned numThreads = 1) : pool(std::max(1u, numThreads)) {}
+
+    Ponderer(const Ponderer&) = delete;
+    Ponderer& operator=(const Ponderer&) = delete;
+
+    ~Ponderer() {
+        finish();
+    }
+
+    // Starts pondering the replies to move, just sent by active from state.
+    // budgetFor gives the thinking time allowed for a predicted state.
+    template <typename Budget>
+    void start(BaseBot& pokerbot, const GameState& gameState, const RoundState& state, Move move, int active,
+               Budget&& budgetFor) {
+        finish();
+        std::shared_ptr<RoundState> waiting = after(state, move);
+        if (!waiting || waiting->getButton() % 2 == active) {
+            return;
+        }
+        for (Move reply : likelyReplies(*waiting, 1 - active)) {
+            std::shared_ptr<RoundState> predicted = after(*waiting, reply);
+            if (!predicted || predicted->getStreet() != waiting->getStreet() || predicted->getButton() % 2 != active) {
+                continue;
+            }
+            Job job;
+            job.predicted = predicted;
+            job.context = std::make_unique<DecisionContext>();
+            const double seconds = budgetFor(*predicted);
+            job.context->reset(Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                                  std::chrono::duration<double>(seconds)),
+                               false);
+            DecisionContext* context = job.context.get();
+            GameState game = gameState;
+            job.result = pool.submit([&pokerbot, predicted, context, game, active]() {
+                if (context->isCancelled()) {
+                    return Move::fold();
+                }
+                return pokerbot.ponder(game, *predicted, active, *context);
+            });
+            jobs.push_back(std::move(job));
+        }
+    }
+
+    // Looks for a pondered decision matching the actual state. Waits for it
+    // until deadline; on success sets move, otherwise falls back to whatever
+    // the job offered if it is still running. Other jobs are cancelled.
+    Take take(const RoundState& actual, Clock::time_point deadline, Move& move) {
+        Job* match = nullptr;
+        for (Job& job : jobs) {
+            if (!match && samePosition(*job.predicted, actual)) {
+                match = &job;
+            } else {
+                job.context->cancel();
+            }
+        }
+        if (!match) {
+            return Take::NO_MATCH;
+        }
+        if (match->result.wait_until(deadline) == std::future_status::ready) {
+            try {
+                move = match->result.get();
+                return Take::READY;
+            } catch (const std::exception&) {
+                return Take::NO_MATCH;
+            }
+        }
+        match->context->cancel();
+        if (match->context->hasBest()) {
+            move = match->context->getBest();
+            return Take::READY;
+        }
+        return Take::OVERRAN;
+    }
+
+    // Cancels all outstanding jobs and waits for them, so the bot is not
+    // called from two places at once.
+    void finish() {
+        for (Job& job : jobs) {
+            job.context->cancel();
+        }
+        for (Job& job : jobs) {
+            if (job.result.valid()) {
+                job.result.wait();
+            }
+        }
+        jobs.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include "../game/card.h"
+#include "../game/poker_moves.h"
+
+// Decoder for engine messages: one line of space-separated clauses, each a
+// one-letter code followed by its argument. Parsing works on string_views
+// into the caller's buffer and never allocates.
+namespace Protocol {
+    enum class EventType : std::uint8_t {
+        TIME,
+        PLAYER,
+        HAND,
+        BOUNTY,
+        BOARD,
+        ACTION,
+        OPPONENT_HAND,
+        DELTA,
+        BOUNTY_HITS,
+        QUIT
+    };
+
+    // One decoded clause. Only the fields for its type are meaningful.
+    struct Event {
+        EventType type;
+        double time;
+        int value;
+        Move move;
+        Hand hand;
+        Board board;
+        char bountyRank;
+        std::array<bool, 2> bountyHits;
+    };
+
+    inline int parseInt(std::string_view text) {
+        int value = 0;
+        auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+            throw std::invalid_argument("Invalid integer: " + std::string(text));
+        }
+        return value;
+    }
+
+    inline double parseDouble(std::string_view text) {
+        double value = 0.0;
+        auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+            throw std::invalid_argument("Invalid number: " + std::string(text));
+        }
+        return value;
+    }
+
+    // Decodes one clause into event; returns false for unknown codes, which
+    // are skipped.
+    inline bool parseClause(std::string_view clause, Event& event) {
+        std::string_view rest = clause.substr(1);
+        switch (clause[0]) {
+            case 'T':
+                event.type = EventType::TIME;
+                event.time = parseDouble(rest);
+                return true;
+            case 'P':
+                event.type = EventType::PLAYER;
+                event.value = static_cast<int>(parseDouble(rest));
+                return true;
+            case 'H':
+                event.type = EventType::HAND;
+                event.hand = Hand::parse(rest);
+                return true;
+            case 'G':
+                event.type = EventType::BOUNTY;
+                event.bountyRank = rest.empty() ? '\0' : rest[0];
+                return true;
+            case 'B':
+                event.type = EventType::BOARD;
+                event.board = Board::parse(rest);
+                return true;
+            case 'F':
+            case 'C':
+            case 'K':
+            case 'R':
+                event.type = EventType::ACTION;
+                event.move = clause[0] == 'R' ? Move::raise(parseInt(rest)) : Move::decode(clause);
+                return true;
+            case 'O':
+                event.type = EventType::OPPONENT_HAND;
+                event.hand = Hand::parse(rest);
+                return true;
+            case 'D':
+                event.type = EventType::DELTA;
+                event.value = parseInt(rest);
+                return true;
+            case 'Y':
+                if (rest.size() < 2) {
+                    throw std::invalid_argument("Invalid bounty clause: " + std::string(clause));
+                }
+                event.type = EventType::BOUNTY_HITS;
+                event.bountyHits = {rest[0] == '1', rest[1] == '1'};
+                return true;
+            case 'Q':
+                event.type = EventType::QUIT;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Calls handler(const Event&) for each clause of one message line, in
+    // order. Stops early and returns false if the handler returns false.
+    template <typename Handler>
+    bool parseMessage(std::string_view line, Handler&& handler) {
+        Event event{};
+        std::size_t position = 0;
+        while (position < line.size()) {
+            std::size_t start = line.find_first_not_of(" \t\r", position);
+            if (start == std::string_view::npos) {
+                break;
+            }
+            std::size_t end = line.find_first_of(" \t\r", start);
+            if (end == std::string_view::npos) {
+                end = line.size();
+            }
+            if (parseClause(line.substr(start, end - start), event) && !handler(event)) {
+                return false;
+            }
+            position = end;
+        }
+        return true;
+    }
+}
+
+#endif
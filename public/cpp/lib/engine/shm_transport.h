@@ -0,0 +1,303 @@
+#ifndef SHM_TRANSPORT_H
+#define SHM_TRANSPORT_H
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <signal.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "transport.h"
+
+// Single-producer single-consumer byte ring living in shared memory. Each
+// side spins briefly on the other's index before sleeping on a futex, so a
+// reply that arrives within a few microseconds never pays for a context
+// switch, and an idle side costs no CPU. A peer that dies cannot close its
+// end, so sleeps wake every PEER_CHECK_INTERVAL to ask whether it is still
+// alive.
+class ShmRing {
+public:
+    static constexpr std::uint32_t CAPACITY = 1 << 16;
+    static constexpr long PEER_CHECK_INTERVAL_NS = 100 * 1000 * 1000;
+
+private:
+    static constexpr std::uint32_t MASK = CAPACITY - 1;
+
+    // Bumped after every publish (dataSequence) or consume (spaceSequence);
+    // these are the futex words. The waiter counts let the other side skip
+    // the wake syscall when nobody sleeps.
+    alignas(64) std::atomic<std::uint32_t> tail;
+    std::atomic<std::uint32_t> dataSequence;
+    std::atomic<std::uint32_t> dataWaiters;
+    std::atomic<std::uint32_t> closed;
+    alignas(64) std::atomic<std::uint32_t> head;
+    std::atomic<std::uint32_t> spaceSequence;
+    std::atomic<std::uint32_t> spaceWaiters;
+    alignas(64) char data[CAPACITY];
+
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "futex words must be lock-free");
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex words must be 32 bits");
+
+    static std::uint32_t* word(std::atomic<std::uint32_t>& value) {
+        return reinterpret_cast<std::uint32_t*>(&value);
+    }
+
+    static void futexWait(std::atomic<std::uint32_t>& value, std::uint32_t expected) {
+        const timespec timeout = {0, PEER_CHECK_INTERVAL_NS};
+        syscall(SYS_futex, word(value), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+    }
+
+    static void futexWake(std::atomic<std::uint32_t>& value) {
+        syscall(SYS_futex, word(value), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+    }
+
+    static void pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Spinning only pays off when the peer runs on another core; on a
+    // single CPU it just burns the peer's time slice.
+    static int spinLimit() {
+        static const int limit = std::thread::hardware_concurrency() > 1 ? 2000 : 0;
+        return limit;
+    }
+
+    // Blocks until ready() holds, spinning first. sequence is the futex word
+    // the other side bumps whenever ready() may have become true. Returns
+    // false, without ready(), once peerAlive() says the other side is gone.
+    template <typename Ready, typename Alive>
+    static bool await(Ready&& ready, std::atomic<std::uint32_t>& sequence, std::atomic<std::uint32_t>& waiters,
+                      Alive&& peerAlive) {
+        const int limit = spinLimit();
+        for (int spin = 0; spin < limit; spin++) {
+            if (ready()) {
+                return true;
+            }
+            pause();
+        }
+        while (true) {
+            std::uint32_t observed = sequence.load();
+            waiters.fetch_add(1);
+            if (ready()) {
+                waiters.fetch_sub(1);
+                return true;
+            }
+            futexWait(sequence, observed);
+            waiters.fetch_sub(1);
+            if (!ready() && !peerAlive()) {
+                return false;
+            }
+        }
+    }
+
+public:
+    ShmRing() : tail(0), dataSequence(0), dataWaiters(0), closed(0), head(0), spaceSequence(0), spaceWaiters(0) {}
+
+    // Producer side: copies all of the bytes in, waiting for space as
+    // needed. Throws if the consumer dies while the ring is full.
+    template <typename Alive>
+    void write(const char* bytes, std::size_t length, Alive&& peerAlive) {
+        while (length > 0) {
+            const std::uint32_t position = tail.load(std::memory_order_relaxed);
+            if (!await([&]() { return position - head.load(std::memory_order_acquire) < CAPACITY; }, spaceSequence,
+                       spaceWaiters, peerAlive)) {
+                throw std::runtime_error("Shared memory peer is gone");
+            }
+            const std::uint32_t free = CAPACITY - (position - head.load(std::memory_order_acquire));
+            const std::uint32_t offset = position & MASK;
+            const std::uint32_t chunk = static_cast<std::uint32_t>(
+                std::min<std::size_t>({length, free, CAPACITY - offset}));
+            std::memcpy(data + offset, bytes, chunk);
+            tail.store(position + chunk, std::memory_order_release);
+            dataSequence.fetch_add(1);
+            if (dataWaiters.load() > 0) {
+                futexWake(dataSequence);
+            }
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+
+    // Consumer side: waits for at least one byte and copies out up to
+    // length. Returns 0 once the producer has closed or died and the ring
+    // is empty.
+    template <typename Alive>
+    std::size_t read(char* bytes, std::size_t length, Alive&& peerAlive) {
+        const std::uint32_t position = head.load(std::memory_order_relaxed);
+        if (!await([&]() { return tail.load(std::memory_order_acquire) != position || closed.load() != 0; },
+                   dataSequence, dataWaiters, peerAlive)) {
+            closed.store(1);
+            return 0;
+        }
+        const std::uint32_t available = tail.load(std::memory_order_acquire) - position;
+        if (available == 0) {
+            return 0;
+        }
+        const std::uint32_t offset = position & MASK;
+        const std::uint32_t chunk = static_cast<std::uint32_t>(
+            std::min<std::size_t>({length, available, CAPACITY - offset}));
+        std::memcpy(bytes, data + offset, chunk);
+        head.store(position + chunk, std::memory_order_release);
+        spaceSequence.fetch_add(1);
+        if (spaceWaiters.load() > 0) {
+            futexWake(spaceSequence);
+        }
+        return chunk;
+    }
+
+    // Producer side: marks the end of the stream and wakes the consumer.
+    void close() {
+        closed.store(1);
+        dataSequence.fetch_add(1);
+        futexWake(dataSequence);
+    }
+};
+
+// Shared segment holding one ring per direction. The dealer creates it and
+// sets magic last; bots only attach to a segment that is fully set up. Each
+// side records its pid so the other can tell when it has died.
+struct ShmSegment {
+    static constexpr std::uint32_t MAGIC = 0x504B5232;  // "PKR2"
+
+    std::atomic<std::uint32_t> magic;
+    std::atomic<std::int32_t> dealerPid;
+    std::atomic<std::int32_t> botPid;
+    ShmRing toBot;
+    ShmRing toEngine;
+};
+
+// Transport over a ShmSegment named like a POSIX shm object ("/name").
+// Intended for co-located evaluation runs where loopback sockets would
+// dominate the per-action cost. The dealer unlinks the name as soon as a
+// bot has attached, so a run that dies later leaves nothing behind.
+class SharedMemoryTransport : public Transport {
+public:
+    enum class Role {
+        BOT,
+        DEALER
+    };
+
+private:
+    std::string name;
+    Role role;
+    ShmSegment* segment;
+    ShmRing* inbound;
+    ShmRing* outbound;
+    bool unlinked;
+    std::function<bool()> peerCheck;
+
+    static bool processAlive(std::int32_t pid) {
+        return ::kill(pid, 0) == 0 || errno == EPERM;
+    }
+
+    // Before a bot attaches only peerCheck can tell; a dealer's bot may die
+    // without ever attaching.
+    bool peerAlive() const {
+        if (peerCheck && !peerCheck()) {
+            return false;
+        }
+        const std::int32_t pid = role == Role::DEALER ? segment->botPid.load() : segment->dealerPid.load();
+        return pid == 0 || processAlive(pid);
+    }
+
+    void unlinkOnceAttached() {
+        if (role == Role::DEALER && !unlinked && segment->botPid.load() != 0) {
+            shm_unlink(name.c_str());
+            unlinked = true;
+        }
+    }
+
+public:
+    SharedMemoryTransport(const std::string& name, Role role)
+        : name(name), role(role), segment(nullptr), unlinked(false), peerCheck() {
+        const bool create = role == Role::DEALER;
+        int fd = shm_open(name.c_str(), create ? O_CREAT | O_EXCL | O_RDWR : O_RDWR, 0600);
+        if (fd == -1) {
+            throw std::runtime_error("shm_open failed for " + name + ": " + std::strerror(errno));
+        }
+        if (create && ftruncate(fd, sizeof(ShmSegment)) != 0) {
+            ::close(fd);
+            shm_unlink(name.c_str());
+            throw std::runtime_error("ftruncate failed for " + name);
+        }
+        void* address = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            if (create) {
+                shm_unlink(name.c_str());
+            }
+            throw std::runtime_error("mmap failed for " + name);
+        }
+
+        if (create) {
+            segment = new (address) ShmSegment();
+            segment->dealerPid.store(static_cast<std::int32_t>(getpid()));
+            segment->botPid.store(0);
+            segment->magic.store(ShmSegment::MAGIC, std::memory_order_release);
+        } else {
+            segment = static_cast<ShmSegment*>(address);
+            if (segment->magic.load(std::memory_order_acquire) != ShmSegment::MAGIC) {
+                munmap(address, sizeof(ShmSegment));
+                throw std::runtime_error("Shared memory segment " + name + " is not initialized");
+            }
+            segment->botPid.store(static_cast<std::int32_t>(getpid()));
+        }
+        inbound = create ? &segment->toEngine : &segment->toBot;
+        outbound = create ? &segment->toBot : &segment->toEngine;
+    }
+
+    SharedMemoryTransport(const SharedMemoryTransport&) = delete;
+    SharedMemoryTransport& operator=(const SharedMemoryTransport&) = delete;
+
+    ~SharedMemoryTransport() override {
+        outbound->close();
+        munmap(segment, sizeof(ShmSegment));
+        if (role == Role::DEALER && !unlinked) {
+            shm_unlink(name.c_str());
+        }
+    }
+
+    // Extra liveness test for the peer, checked with its pid whenever a
+    // wait times out; the dealer uses it to notice a child bot that exited.
+    void watchPeer(std::function<bool()> check) {
+        peerCheck = std::move(check);
+    }
+
+    std::size_t receive(char* buffer, std::size_t length) override {
+        const std::size_t received = inbound->read(buffer, length, [this]() { return peerAlive(); });
+        unlinkOnceAttached();
+        return received;
+    }
+
+    void send(const char* data, std::size_t length) override {
+        outbound->write(data, length, [this]() { return peerAlive(); });
+    }
+
+    // Ends the outgoing stream; the peer's receive() then returns 0.
+    void close() {
+        outbound->close();
+    }
+};
+
+#endif
+
+#endif
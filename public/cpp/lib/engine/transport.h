@@ -0,0 +1,320 @@
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Byte stream between the bot and the engine.
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    // Blocks until at least one byte is available, then reads up to length
+    // bytes. Returns 0 once the engine has closed the stream.
+    virtual std::size_t receive(char* buffer, std::size_t length) = 0;
+
+    // Writes all of data; callers pass a whole message so it goes out in
+    // one system call.
+    virtual void send(const char* data, std::size_t length) = 0;
+};
+
+// Adapter over iostreams, for tests and tools that drive a bot in-process.
+class StreamTransport : public Transport {
+private:
+    std::istream& in;
+    std::ostream& out;
+
+public:
+    StreamTransport(std::istream& in, std::ostream& out) : in(in), out(out) {}
+
+    std::size_t receive(char* buffer, std::size_t length) override {
+        if (length == 0 || !in.get(buffer[0])) {
+            return 0;
+        }
+        return 1 + static_cast<std::size_t>(in.readsome(buffer + 1, static_cast<std::streamsize>(length - 1)));
+    }
+
+    void send(const char* data, std::size_t length) override {
+        out.write(data, static_cast<std::streamsize>(length));
+        out.flush();
+    }
+};
+
+// TCP connection to the engine with Nagle's algorithm disabled, so each
+// action leaves in its own segment immediately.
+class SocketTransport : public Transport {
+private:
+#ifdef _WIN32
+    SOCKET sock;
+#else
+    int sock;
+#endif
+
+public:
+    SocketTransport(const std::string& host, int port) {
+#ifdef _WIN32
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+            throw std::runtime_error("WSAStartup failed");
+        }
+#endif
+        struct addrinfo hints = {}, *result = nullptr;
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+
+        if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result) != 0) {
+            throw std::runtime_error("getaddrinfo failed");
+        }
+
+        sock = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+#ifdef _WIN32
+        if (sock == INVALID_SOCKET) {
+            freeaddrinfo(result);
+            WSACleanup();
+            throw std::runtime_error("socket failed");
+        }
+#else
+        if (sock == -1) {
+            freeaddrinfo(result);
+            throw std::runtime_error("socket failed");
+        }
+#endif
+
+        if (connect(sock, result->ai_addr, (int)result->ai_addrlen) != 0) {
+#ifdef _WIN32
+            closesocket(sock);
+            freeaddrinfo(result);
+            WSACleanup();
+#else
+            close(sock);
+            freeaddrinfo(result);
+#endif
+            throw std::runtime_error("connect failed");
+        }
+
+        freeaddrinfo(result);
+
+        int noDelay = 1;
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+    }
+
+    SocketTransport(const SocketTransport&) = delete;
+    SocketTransport& operator=(const SocketTransport&) = delete;
+
+    ~SocketTransport() override {
+#ifdef _WIN32
+        closesocket(sock);
+        WSACleanup();
+#else
+        close(sock);
+#endif
+    }
+
+    std::size_t receive(char* buffer, std::size_t length) override {
+        while (true) {
+#ifdef _WIN32
+            int received = recv(sock, buffer, static_cast<int>(length), 0);
+#else
+            ssize_t received = recv(sock, buffer, length, 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (received < 0) {
+                throw std::runtime_error("recv failed");
+            }
+            return static_cast<std::size_t>(received);
+        }
+    }
+
+    void send(const char* data, std::size_t length) override {
+        while (length > 0) {
+#ifdef _WIN32
+            int sent = ::send(sock, data, static_cast<int>(length), 0);
+#else
+#ifdef MSG_NOSIGNAL
+            ssize_t sent = ::send(sock, data, length, MSG_NOSIGNAL);
+#else
+            ssize_t sent = ::send(sock, data, length, 0);
+#endif
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+#endif
+            if (sent < 0) {
+                throw std::runtime_error("send failed");
+            }
+            data += sent;
+            length -= static_cast<std::size_t>(sent);
+        }
+    }
+};
+
+#ifndef _WIN32
+// Engine stream over already-open file descriptors: inherited pipes, or
+// stdin/stdout when the dealer spawns the bot directly.
+class FdTransport : public Transport {
+protected:
+    int readFd;
+    int writeFd;
+    bool ownsFds;
+
+public:
+    FdTransport(int readFd, int writeFd, bool ownsFds = false)
+        : readFd(readFd), writeFd(writeFd), ownsFds(ownsFds) {}
+
+    FdTransport(const FdTransport&) = delete;
+    FdTransport& operator=(const FdTransport&) = delete;
+
+    ~FdTransport() override {
+        if (ownsFds) {
+            close(readFd);
+            if (writeFd != readFd) {
+                close(writeFd);
+            }
+        }
+    }
+
+    std::size_t receive(char* buffer, std::size_t length) override {
+        while (true) {
+            ssize_t received = read(readFd, buffer, length);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received < 0) {
+                throw std::runtime_error("read failed");
+            }
+            return static_cast<std::size_t>(received);
+        }
+    }
+
+    void send(const char* data, std::size_t length) override {
+        while (length > 0) {
+            ssize_t written = write(writeFd, data, length);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written < 0) {
+                throw std::runtime_error("write failed");
+            }
+            data += written;
+            length -= static_cast<std::size_t>(written);
+        }
+    }
+};
+
+// Unix-domain stream socket, for a dealer on the same host without the
+// loopback TCP stack in the way.
+class UnixSocketTransport : public FdTransport {
+public:
+    explicit UnixSocketTransport(const std::string& path) : FdTransport(-1, -1, true) {
+        struct sockaddr_un address = {};
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Unix socket path too long: " + path);
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (sock == -1) {
+            throw std::runtime_error("socket failed");
+        }
+        if (connect(sock, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0) {
+            close(sock);
+            throw std::runtime_error("connect failed for " + path);
+        }
+        readFd = sock;
+        writeFd = sock;
+    }
+};
+#endif
+
+// Ring buffer of received bytes, handed out one line at a time. A line
+// that wraps around the end of the ring is copied into a side buffer; all
+// others are returned in place.
+class ReceiveBuffer {
+public:
+    static constexpr std::size_t CAPACITY = 1 << 16;
+
+private:
+    static constexpr std::size_t MASK = CAPACITY - 1;
+
+    std::array<char, CAPACITY> ring;
+    std::array<char, CAPACITY> unwrapped;
+    std::size_t head;
+    std::size_t tail;
+    std::size_t scanned;
+
+public:
+    ReceiveBuffer() : ring(), unwrapped(), head(0), tail(0), scanned(0) {}
+
+    // Reads whatever the transport has, blocking if it has nothing yet.
+    // Returns false at end of stream.
+    bool fill(Transport& transport) {
+        std::size_t free = CAPACITY - (tail - head);
+        if (free == 0) {
+            throw std::length_error("Engine message exceeds receive buffer");
+        }
+        std::size_t offset = tail & MASK;
+        std::size_t received = transport.receive(ring.data() + offset, std::min(free, CAPACITY - offset));
+        tail += received;
+        return received > 0;
+    }
+
+    // Sets line to the next complete line, without its line ending. The
+    // view stays valid until the next call to fill().
+    bool nextLine(std::string_view& line) {
+        while (scanned < tail) {
+            std::size_t offset = scanned & MASK;
+            std::size_t span = std::min(tail - scanned, CAPACITY - offset);
+            const void* found = std::memchr(ring.data() + offset, '\n', span);
+            if (!found) {
+                scanned += span;
+                continue;
+            }
+            std::size_t end = scanned + static_cast<std::size_t>(static_cast<const char*>(found) - (ring.data() + offset));
+            std::size_t length = end - head;
+            std::size_t start = head & MASK;
+            if (start + length <= CAPACITY) {
+                line = std::string_view(ring.data() + start, length);
+            } else {
+                std::size_t first = CAPACITY - start;
+                std::memcpy(unwrapped.data(), ring.data() + start, first);
+                std::memcpy(unwrapped.data() + first, ring.data(), length - first);
+                line = std::string_view(unwrapped.data(), length);
+            }
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            head = end + 1;
+            scanned = head;
+            return true;
+        }
+        return false;
+    }
+};
+
+#endif
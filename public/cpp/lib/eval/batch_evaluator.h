@@ -0,0 +1,191 @@
+#ifndef BATCH_EVALUATOR_H
+#define BATCH_EVALUATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../game/card.h"
+#include "hand_evaluator.h"
+#include "hole_combos.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Evaluates many card sets per call. With AVX2 enabled (-mavx2 or
+// -march=native) eight sets are ranked at once using table gathers;
+// otherwise every set goes through the scalar HandEvaluator. Both paths
+// return identical ranks.
+namespace BatchEvaluator {
+    static_assert(sizeof(CardSet) == sizeof(std::uint64_t), "CardSet must be a bare 64-bit mask");
+
+#if defined(__AVX2__)
+    namespace detail {
+        inline __m256i gatherInfo(__m256i masks) {
+            return _mm256_i32gather_epi32(
+                reinterpret_cast<const int*>(HandEvaluator::detail::RANK_TABLE.info.data()), masks, 4);
+        }
+
+        inline __m256i topRank(__m256i info) {
+            return _mm256_and_si256(_mm256_srli_epi32(info, 16), _mm256_set1_epi32(0xF));
+        }
+
+        // All inputs are small non-negative values, so a signed compare suffices.
+        inline __m256i nonZero(__m256i v) {
+            return _mm256_cmpgt_epi32(v, _mm256_setzero_si256());
+        }
+
+        inline __m256i category(HandEvaluator::Category c) {
+            return _mm256_set1_epi32(static_cast<int>(c) << HandEvaluator::detail::CATEGORY_SHIFT);
+        }
+
+        // Per-16-bit-lane population count.
+        inline __m256i popcount16(__m256i x) {
+            x = _mm256_sub_epi16(x, _mm256_and_si256(_mm256_srli_epi16(x, 1), _mm256_set1_epi16(0x5555)));
+            x = _mm256_add_epi16(_mm256_and_si256(x, _mm256_set1_epi16(0x3333)),
+                                 _mm256_and_si256(_mm256_srli_epi16(x, 2), _mm256_set1_epi16(0x3333)));
+            x = _mm256_and_si256(_mm256_add_epi16(x, _mm256_srli_epi16(x, 4)), _mm256_set1_epi16(0x0F0F));
+            return _mm256_and_si256(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), _mm256_set1_epi16(0x1F));
+        }
+
+        // Ranks the eight sets held in a (sets 0-3) and b (sets 4-7).
+        inline __m256i evaluate8(__m256i a, __m256i b) {
+            using HandEvaluator::Category;
+            const __m256i split = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+            __m256i pa = _mm256_permutevar8x32_epi32(a, split);
+            __m256i pb = _mm256_permutevar8x32_epi32(b, split);
+            __m256i lo = _mm256_permute2x128_si256(pa, pb, 0x20);
+            __m256i hi = _mm256_permute2x128_si256(pa, pb, 0x31);
+
+            const __m256i rankMask = _mm256_set1_epi32(0x1FFF);
+            const __m256i one = _mm256_set1_epi32(1);
+            const __m256i four32 = _mm256_set1_epi32(4);
+            __m256i s0 = _mm256_and_si256(lo, rankMask);
+            __m256i s1 = _mm256_and_si256(_mm256_srli_epi32(lo, 16), rankMask);
+            __m256i s2 = _mm256_and_si256(hi, rankMask);
+            __m256i s3 = _mm256_and_si256(_mm256_srli_epi32(hi, 16), rankMask);
+
+            __m256i countLo = popcount16(lo);
+            __m256i countHi = popcount16(hi);
+            const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+            __m256i flush = _mm256_and_si256(s0, _mm256_cmpgt_epi32(_mm256_and_si256(countLo, low16), four32));
+            flush = _mm256_or_si256(flush, _mm256_and_si256(s1, _mm256_cmpgt_epi32(_mm256_srli_epi32(countLo, 16), four32)));
+            flush = _mm256_or_si256(flush, _mm256_and_si256(s2, _mm256_cmpgt_epi32(_mm256_and_si256(countHi, low16), four32)));
+            flush = _mm256_or_si256(flush, _mm256_and_si256(s3, _mm256_cmpgt_epi32(_mm256_srli_epi32(countHi, 16), four32)));
+
+            __m256i s01 = _mm256_or_si256(s0, s1);
+            __m256i s23 = _mm256_or_si256(s2, s3);
+            __m256i both01 = _mm256_and_si256(s0, s1);
+            __m256i both23 = _mm256_and_si256(s2, s3);
+            __m256i any = _mm256_or_si256(s01, s23);
+            __m256i two = _mm256_or_si256(_mm256_or_si256(both01, both23), _mm256_and_si256(s01, s23));
+            __m256i three = _mm256_or_si256(_mm256_and_si256(both01, s23), _mm256_and_si256(both23, s01));
+            __m256i quads = _mm256_and_si256(both01, both23);
+
+            __m256i anyInfo = gatherInfo(any);
+            __m256i flushInfo = gatherInfo(flush);
+            __m256i pairInfo = gatherInfo(two);
+            __m256i tripsRank = topRank(gatherInfo(three));
+            __m256i quadRank = topRank(gatherInfo(quads));
+            __m256i pairHigh = topRank(pairInfo);
+            __m256i pairLow = _mm256_and_si256(_mm256_srli_epi32(pairInfo, 12), _mm256_set1_epi32(0xF));
+
+            __m256i hasTwo = nonZero(two);
+            __m256i hasThree = nonZero(three);
+            __m256i hasQuads = nonZero(quads);
+            __m256i hasFlush = nonZero(flush);
+
+            __m256i removed = _mm256_blendv_epi8(pairHigh, tripsRank, hasThree);
+            removed = _mm256_blendv_epi8(removed, quadRank, hasQuads);
+            __m256i kickInfo = gatherInfo(_mm256_andnot_si256(_mm256_sllv_epi32(one, removed), any));
+
+            __m256i fullPairs = _mm256_andnot_si256(_mm256_sllv_epi32(one, tripsRank), two);
+            __m256i fullInfo = gatherInfo(fullPairs);
+            __m256i topPairs = _mm256_or_si256(_mm256_sllv_epi32(one, pairHigh), _mm256_sllv_epi32(one, pairLow));
+            __m256i twoPairInfo = gatherInfo(_mm256_andnot_si256(topPairs, any));
+
+            const __m256i kickerMask = _mm256_set1_epi32(HandEvaluator::detail::KICKER_MASK);
+            const __m256i nibble = _mm256_set1_epi32(0xF);
+            __m256i anyStraight = _mm256_srli_epi32(anyInfo, HandEvaluator::detail::STRAIGHT_SHIFT);
+            __m256i flushStraight = _mm256_srli_epi32(flushInfo, HandEvaluator::detail::STRAIGHT_SHIFT);
+            __m256i pairCount = _mm256_and_si256(_mm256_srli_epi32(pairInfo, HandEvaluator::detail::COUNT_SHIFT), nibble);
+
+            __m256i result = _mm256_or_si256(category(Category::HIGH_CARD), _mm256_and_si256(anyInfo, kickerMask));
+
+            __m256i value = _mm256_or_si256(category(Category::ONE_PAIR), _mm256_slli_epi32(pairHigh, 16));
+            value = _mm256_or_si256(value, _mm256_srli_epi32(_mm256_and_si256(kickInfo, _mm256_set1_epi32(0xFFF00)), 4));
+            result = _mm256_blendv_epi8(result, value, hasTwo);
+
+            value = _mm256_or_si256(category(Category::TWO_PAIR), _mm256_and_si256(pairInfo, _mm256_set1_epi32(0xFF000)));
+            value = _mm256_or_si256(value, _mm256_slli_epi32(topRank(twoPairInfo), 8));
+            result = _mm256_blendv_epi8(result, value, _mm256_cmpgt_epi32(pairCount, one));
+
+            value = _mm256_or_si256(category(Category::THREE_OF_A_KIND), _mm256_slli_epi32(tripsRank, 16));
+            value = _mm256_or_si256(value, _mm256_srli_epi32(_mm256_and_si256(kickInfo, _mm256_set1_epi32(0xFF000)), 4));
+            result = _mm256_blendv_epi8(result, value, hasThree);
+
+            value = _mm256_or_si256(category(Category::STRAIGHT), _mm256_slli_epi32(_mm256_sub_epi32(anyStraight, one), 16));
+            result = _mm256_blendv_epi8(result, value, nonZero(anyStraight));
+
+            value = _mm256_or_si256(category(Category::FLUSH), _mm256_and_si256(flushInfo, kickerMask));
+            result = _mm256_blendv_epi8(result, value, hasFlush);
+
+            value = _mm256_or_si256(category(Category::FULL_HOUSE), _mm256_slli_epi32(tripsRank, 16));
+            value = _mm256_or_si256(value, _mm256_slli_epi32(topRank(fullInfo), 12));
+            result = _mm256_blendv_epi8(result, value, _mm256_and_si256(hasThree, nonZero(fullPairs)));
+
+            value = _mm256_or_si256(category(Category::FOUR_OF_A_KIND), _mm256_slli_epi32(quadRank, 16));
+            value = _mm256_or_si256(value, _mm256_slli_epi32(topRank(kickInfo), 12));
+            result = _mm256_blendv_epi8(result, value, hasQuads);
+
+            value = _mm256_or_si256(category(Category::STRAIGHT_FLUSH), _mm256_slli_epi32(_mm256_sub_epi32(flushStraight, one), 16));
+            result = _mm256_blendv_epi8(result, value, _mm256_and_si256(hasFlush, nonZero(flushStraight)));
+
+            return result;
+        }
+    }
+#endif
+
+    inline void evaluate(const CardSet* sets, HandEvaluator::HandRank* out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const std::size_t vectorCount = count - count % 8;
+        for (; i < vectorCount; i += 8) {
+            const __m256i* source = reinterpret_cast<const __m256i*>(sets + i);
+            __m256i ranks = detail::evaluate8(_mm256_loadu_si256(source), _mm256_loadu_si256(source + 1));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), ranks);
+        }
+#endif
+        for (; i < count; i++) {
+            out[i] = HandEvaluator::evaluate(sets[i]);
+        }
+    }
+
+    // Ranks every hole combo on the given board (at most five cards) into
+    // out[HoleCombos::NUM_COMBOS]. Combos that share a card with the board
+    // get rank 0, below any real hand.
+    inline void evaluateBoard(CardSet board, HandEvaluator::HandRank* out) {
+        const std::uint64_t* combos = HoleCombos::masks();
+        const std::uint64_t boardBits = board.getBits();
+        int i = 0;
+#if defined(__AVX2__)
+        const __m256i boardVec = _mm256_set1_epi64x(static_cast<long long>(boardBits));
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i split = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        for (; i + 8 <= HoleCombos::NUM_COMBOS; i += 8) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(combos + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(combos + i + 4));
+            __m256i blockedA = _mm256_cmpeq_epi64(_mm256_and_si256(a, boardVec), zero);
+            __m256i blockedB = _mm256_cmpeq_epi64(_mm256_and_si256(b, boardVec), zero);
+            __m256i live = _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(blockedA, split),
+                                                     _mm256_permutevar8x32_epi32(blockedB, split), 0x20);
+            __m256i ranks = detail::evaluate8(_mm256_or_si256(a, boardVec), _mm256_or_si256(b, boardVec));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_and_si256(ranks, live));
+        }
+#endif
+        for (; i < HoleCombos::NUM_COMBOS; i++) {
+            out[i] = (combos[i] & boardBits) ? 0 : HandEvaluator::evaluate(CardSet(combos[i] | boardBits));
+        }
+    }
+}
+
+#endif
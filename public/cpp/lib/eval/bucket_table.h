@@ -0,0 +1,126 @@
+#ifndef BUCKET_TABLE_H
+#define BUCKET_TABLE_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../game/card.h"
+#include "hand_indexer.h"
+
+// On-disk layout of a card abstraction for one round of HandIndexer::holdem():
+// this header followed by one uint16 bucket per canonical hand index. The
+// builder updates completedEntries as it goes, which is what makes a partial
+// file resumable.
+struct BucketFileHeader {
+    static constexpr char MAGIC[8] = {'P', 'A', 'B', 'B', 'K', 'T', '0', '1'};
+
+    char magic[8];
+    std::uint32_t round;
+    std::uint32_t numBuckets;
+    std::uint64_t numEntries;
+    std::uint64_t completedEntries;
+    std::uint64_t dataOffset;
+};
+
+// Read-only view of a bucket file. On POSIX systems the file is mapped, so
+// loading costs a page-table setup and buckets are paged in on first use.
+class BucketTable {
+private:
+    BucketFileHeader header;
+    const std::uint16_t* buckets;
+    std::vector<std::uint16_t> storage;
+#ifndef _WIN32
+    void* mapping;
+    std::size_t mappingSize;
+#endif
+
+public:
+    explicit BucketTable(const std::string& path) : header(), buckets(nullptr) {
+#ifndef _WIN32
+        mapping = nullptr;
+        mappingSize = 0;
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open bucket file " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(BucketFileHeader)) {
+            close(fd);
+            throw std::runtime_error("Bucket file too small: " + path);
+        }
+        mappingSize = static_cast<std::size_t>(info.st_size);
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            throw std::runtime_error("mmap failed for " + path);
+        }
+        std::memcpy(&header, mapping, sizeof(header));
+        if (std::memcmp(header.magic, BucketFileHeader::MAGIC, sizeof(header.magic)) != 0 ||
+            header.dataOffset + header.numEntries * sizeof(std::uint16_t) > mappingSize) {
+            munmap(mapping, mappingSize);
+            throw std::runtime_error("Invalid bucket file " + path);
+        }
+        buckets = reinterpret_cast<const std::uint16_t*>(static_cast<const char*>(mapping) + header.dataOffset);
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, BucketFileHeader::MAGIC, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Invalid bucket file " + path);
+        }
+        storage.resize(header.numEntries);
+        in.seekg(static_cast<std::streamoff>(header.dataOffset));
+        in.read(reinterpret_cast<char*>(storage.data()),
+                static_cast<std::streamsize>(storage.size() * sizeof(std::uint16_t)));
+        buckets = storage.data();
+#endif
+    }
+
+    BucketTable(const BucketTable&) = delete;
+    BucketTable& operator=(const BucketTable&) = delete;
+
+    ~BucketTable() {
+#ifndef _WIN32
+        if (mapping) {
+            munmap(mapping, mappingSize);
+        }
+#endif
+    }
+
+    int getRound() const {
+        return static_cast<int>(header.round);
+    }
+
+    int getNumBuckets() const {
+        return static_cast<int>(header.numBuckets);
+    }
+
+    std::uint64_t size() const {
+        return header.numEntries;
+    }
+
+    bool isComplete() const {
+        return header.completedEntries == header.numEntries;
+    }
+
+    int getBucket(std::uint64_t canonicalIndex) const {
+        return buckets[canonicalIndex];
+    }
+
+    int getBucket(const Hand& hole, const Board& board) const {
+        return getBucket(HandIndexer::holdem().index(hole, board));
+    }
+};
+
+#endif
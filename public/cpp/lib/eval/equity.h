@@ -0,0 +1,209 @@
+#ifndef EQUITY_H
+#define EQUITY_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../game/card.h"
+#include "../game/round_state.h"
+#include "../util/fast_rng.h"
+#include "../util/thread_pool.h"
+#include "hand_evaluator.h"
+#include "hole_combos.h"
+
+struct EquityResult {
+    double win = 0.0;
+    double tie = 0.0;
+    std::uint64_t samples = 0;
+    double stdError = 0.0;
+
+    double getEquity() const {
+        return win + tie / 2.0;
+    }
+};
+
+// Sampling stops at whichever comes first: the deadline, maxSamples, or the
+// standard error of the equity estimate dropping to targetStdError (once
+// minSamples have been drawn). A zero targetStdError disables that check.
+struct EquityOptions {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    double targetStdError = 0.0;
+    std::uint64_t minSamples = 1000;
+    std::uint64_t maxSamples = 10000000;
+};
+
+// Opponent weights indexed by HoleCombos index. Empty means every unblocked
+// combo is equally likely.
+using ComboWeights = std::vector<float>;
+
+class EquityCalculator {
+private:
+    static constexpr int BATCH_SIZE = 256;
+
+    struct SharedTally {
+        std::atomic<std::uint64_t> samples{0};
+        std::atomic<std::uint64_t> halfPoints{0};
+        std::atomic<std::uint64_t> quarterSquares{0};
+        std::atomic<bool> done{false};
+    };
+
+    struct Job {
+        CardSet hero;
+        CardSet board;
+        int missing;
+        std::vector<int> combos;
+        std::vector<double> cumulative;
+        EquityOptions options;
+    };
+
+    ThreadPool pool;
+    std::atomic<std::uint64_t> seedCounter;
+
+    static double stdErrorOf(std::uint64_t samples, std::uint64_t halfPoints, std::uint64_t quarterSquares) {
+        if (samples < 2) {
+            return 1.0;
+        }
+        double n = static_cast<double>(samples);
+        double mean = halfPoints / (2.0 * n);
+        double variance = std::max(0.0, quarterSquares / (4.0 * n) - mean * mean);
+        return std::sqrt(variance / n);
+    }
+
+    static Card drawCard(FastRng& rng, CardSet& used) {
+        while (true) {
+            Card card = Card::fromIndex(static_cast<int>(rng.below(Card::NUM_CARDS)));
+            if (!used.contains(card)) {
+                used.add(card);
+                return card;
+            }
+        }
+    }
+
+    static void runWorker(const Job& job, SharedTally& tally, std::uint64_t seed) {
+        FastRng rng(seed);
+        const CardSet dead = job.hero | job.board;
+
+        while (!tally.done.load(std::memory_order_relaxed)) {
+            std::uint64_t halfPoints = 0;
+            std::uint64_t quarterSquares = 0;
+
+            for (int i = 0; i < BATCH_SIZE; i++) {
+                CardSet used = dead;
+                CardSet opponent;
+                if (job.combos.empty()) {
+                    opponent.add(drawCard(rng, used));
+                    opponent.add(drawCard(rng, used));
+                } else {
+                    double target = rng.uniform() * job.cumulative.back();
+                    std::size_t pick = std::upper_bound(job.cumulative.begin(), job.cumulative.end(), target) -
+                                       job.cumulative.begin();
+                    opponent = HoleCombos::getMask(job.combos[std::min(pick, job.combos.size() - 1)]);
+                    used |= opponent;
+                }
+
+                CardSet runout = job.board;
+                for (int k = 0; k < job.missing; k++) {
+                    runout.add(drawCard(rng, used));
+                }
+
+                HandEvaluator::HandRank heroRank = HandEvaluator::evaluate(job.hero | runout);
+                HandEvaluator::HandRank opponentRank = HandEvaluator::evaluate(opponent | runout);
+                if (heroRank > opponentRank) {
+                    halfPoints += 2;
+                    quarterSquares += 4;
+                } else if (heroRank == opponentRank) {
+                    halfPoints += 1;
+                    quarterSquares += 1;
+                }
+            }
+
+            std::uint64_t samples = tally.samples.fetch_add(BATCH_SIZE) + BATCH_SIZE;
+            std::uint64_t totalHalf = tally.halfPoints.fetch_add(halfPoints) + halfPoints;
+            std::uint64_t totalQuarter = tally.quarterSquares.fetch_add(quarterSquares) + quarterSquares;
+
+            const EquityOptions& options = job.options;
+            bool finished = samples >= options.maxSamples ||
+                            std::chrono::steady_clock::now() >= options.deadline ||
+                            (options.targetStdError > 0.0 && samples >= options.minSamples &&
+                             stdErrorOf(samples, totalHalf, totalQuarter) <= options.targetStdError);
+            if (finished) {
+                tally.done.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    explicit EquityCalculator(unsigned numThreads = std::max(1u, std::thread::hardware_concurrency()))
+        : pool(numThreads), seedCounter(std::random_device()()) {}
+
+    EquityResult estimate(const Hand& hero, const Board& board, const ComboWeights& opponent,
+                          const EquityOptions& options) {
+        if (hero.size() != 2 || board.size() > 5) {
+            throw std::invalid_argument("Equity needs two hole cards and at most five board cards");
+        }
+
+        Job job;
+        job.hero = hero.getMask();
+        job.board = board.getMask();
+        job.missing = 5 - static_cast<int>(board.size());
+        job.options = options;
+
+        if (!opponent.empty()) {
+            const CardSet dead = job.hero | job.board;
+            double total = 0.0;
+            for (int i = 0; i < HoleCombos::NUM_COMBOS && i < static_cast<int>(opponent.size()); i++) {
+                if (opponent[i] > 0.0f && !HoleCombos::getMask(i).intersects(dead)) {
+                    total += opponent[i];
+                    job.combos.push_back(i);
+                    job.cumulative.push_back(total);
+                }
+            }
+            if (job.combos.empty()) {
+                throw std::invalid_argument("Opponent range is empty after card removal");
+            }
+        }
+
+        SharedTally tally;
+        std::vector<std::future<void>> workers;
+        for (unsigned i = 0; i < pool.getNumThreads(); i++) {
+            std::uint64_t seed = seedCounter.fetch_add(1);
+            workers.push_back(pool.submit([&job, &tally, seed] { runWorker(job, tally, seed); }));
+        }
+        for (auto& worker : workers) {
+            worker.get();
+        }
+
+        EquityResult result;
+        result.samples = tally.samples.load();
+        std::uint64_t halfPoints = tally.halfPoints.load();
+        std::uint64_t quarterSquares = tally.quarterSquares.load();
+        double n = static_cast<double>(result.samples);
+        // halfPoints counts 2 per win and 1 per tie, quarterSquares 4 and 1.
+        std::uint64_t wins = (quarterSquares - halfPoints) / 2;
+        std::uint64_t ties = halfPoints - 2 * wins;
+        result.win = wins / n;
+        result.tie = ties / n;
+        result.stdError = stdErrorOf(result.samples, halfPoints, quarterSquares);
+        return result;
+    }
+
+    // Hero's equity in the given state against an opponent range, using the
+    // first getStreet() cards of the deck as the visible board.
+    EquityResult estimate(const RoundState& roundState, int active, const ComboWeights& opponent,
+                          const EquityOptions& options) {
+        Board visible;
+        for (int i = 0; i < roundState.getStreet() && i < static_cast<int>(roundState.getDeck().size()); i++) {
+            visible.push_back(roundState.getDeck()[i]);
+        }
+        return estimate(roundState.getHands()[active], visible, opponent, options);
+    }
+};
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef EXACT_EQUITY_H
+#define EXACT_EQUITY_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "../game/card.h"
+#include "../game/round_state.h"
+#include "batch_evaluator.h"
+#include "equity.h"
+#include "hand_evaluator.h"
+#include "hole_combos.h"
+#include "range.h"
+
+// Exact equity on the flop, turn and river by enumerating every runout.
+// For each complete five-card board the ranks of all 1326 combos are
+// computed once and cached, keyed by the two cards added to the flop. A
+// turn or river query on the same flop therefore only re-reads the runouts
+// that are still possible instead of evaluating anything again.
+class ExactEquity {
+private:
+    std::vector<HandEvaluator::HandRank> ranks;
+    std::vector<bool> ready;
+    CardSet flop;
+    Board board;
+
+    const HandEvaluator::HandRank* runoutRanks(Card first, Card second) {
+        int key = HoleCombos::indexOf(first, second);
+        HandEvaluator::HandRank* slot = ranks.data() + static_cast<std::size_t>(key) * HoleCombos::NUM_COMBOS;
+        if (!ready[key]) {
+            BatchEvaluator::evaluateBoard(flop | CardSet(first) | CardSet(second), slot);
+            ready[key] = true;
+        }
+        return slot;
+    }
+
+    template <typename Visit>
+    void forEachRunout(CardSet dead, Visit&& visit) {
+        if (board.size() < 3) {
+            throw std::logic_error("ExactEquity::setBoard must be called first");
+        }
+        if (board.size() == 5) {
+            visit(runoutRanks(board[3], board[4]), board.getMask());
+            return;
+        }
+        if (board.size() == 4) {
+            for (int r = 0; r < Card::NUM_CARDS; r++) {
+                Card river = Card::fromIndex(r);
+                if (!dead.contains(river)) {
+                    visit(runoutRanks(board[3], river), board.getMask() | CardSet(river));
+                }
+            }
+            return;
+        }
+        for (int t = 0; t < Card::NUM_CARDS; t++) {
+            Card turn = Card::fromIndex(t);
+            if (dead.contains(turn)) {
+                continue;
+            }
+            for (int r = t + 1; r < Card::NUM_CARDS; r++) {
+                Card river = Card::fromIndex(r);
+                if (!dead.contains(river)) {
+                    visit(runoutRanks(turn, river), flop | CardSet(turn) | CardSet(river));
+                }
+            }
+        }
+    }
+
+public:
+    ExactEquity() : ready(HoleCombos::NUM_COMBOS, false) {}
+
+    // Accepts a flop, turn or river board. Runouts cached for the same flop
+    // are kept; a different flop clears the cache.
+    void setBoard(const Board& newBoard) {
+        if (newBoard.size() < 3) {
+            throw std::invalid_argument("Exact equity needs at least a flop");
+        }
+        CardSet newFlop = newBoard.getMask(3);
+        if (newFlop != flop) {
+            flop = newFlop;
+            ready.assign(HoleCombos::NUM_COMBOS, false);
+        }
+        if (ranks.empty()) {
+            ranks.resize(static_cast<std::size_t>(HoleCombos::NUM_COMBOS) * HoleCombos::NUM_COMBOS);
+        }
+        board = newBoard;
+    }
+
+    const Board& getBoard() const {
+        return board;
+    }
+
+    EquityResult vsHand(const Hand& hero, const Hand& opponent) {
+        const int heroIndex = HoleCombos::indexOf(hero);
+        const int opponentIndex = HoleCombos::indexOf(opponent);
+        const CardSet dead = board.getMask() | hero.getMask() | opponent.getMask();
+
+        std::uint64_t wins = 0;
+        std::uint64_t ties = 0;
+        std::uint64_t total = 0;
+        forEachRunout(dead, [&](const HandEvaluator::HandRank* table, CardSet) {
+            HandEvaluator::HandRank heroRank = table[heroIndex];
+            HandEvaluator::HandRank opponentRank = table[opponentIndex];
+            wins += heroRank > opponentRank;
+            ties += heroRank == opponentRank;
+            total++;
+        });
+
+        EquityResult result;
+        result.samples = total;
+        if (total > 0) {
+            result.win = static_cast<double>(wins) / total;
+            result.tie = static_cast<double>(ties) / total;
+        }
+        return result;
+    }
+
+    EquityResult vsRange(const Hand& hero, const Range& opponent) {
+        const int heroIndex = HoleCombos::indexOf(hero);
+        const CardSet dead = board.getMask() | hero.getMask();
+        const std::uint64_t* combos = HoleCombos::masks();
+
+        Range weights = opponent;
+        weights.removeBlocked(dead);
+
+        double win = 0.0;
+        double tie = 0.0;
+        double total = 0.0;
+        std::uint64_t pairs = 0;
+        forEachRunout(dead, [&](const HandEvaluator::HandRank* table, CardSet runoutBoard) {
+            const HandEvaluator::HandRank heroRank = table[heroIndex];
+            const std::uint64_t runoutBits = runoutBoard.getBits();
+            for (int i = 0; i < HoleCombos::NUM_COMBOS; i++) {
+                if (weights[i] == 0.0f || (combos[i] & runoutBits)) {
+                    continue;
+                }
+                total += weights[i];
+                if (heroRank > table[i]) {
+                    win += weights[i];
+                } else if (heroRank == table[i]) {
+                    tie += weights[i];
+                }
+                pairs++;
+            }
+        });
+
+        EquityResult result;
+        result.samples = pairs;
+        if (total > 0.0) {
+            result.win = win / total;
+            result.tie = tie / total;
+        }
+        return result;
+    }
+
+    // Opponent weights follow the ComboWeights convention of EquityCalculator:
+    // indexed by HoleCombos, empty for a uniformly random hand.
+    EquityResult vsRange(const Hand& hero, const ComboWeights& opponent) {
+        Range range = opponent.empty() ? Range::uniform() : Range();
+        for (int i = 0; i < HoleCombos::NUM_COMBOS && i < static_cast<int>(opponent.size()); i++) {
+            range[i] = opponent[i];
+        }
+        return vsRange(hero, range);
+    }
+
+    EquityResult vsRange(const RoundState& roundState, int active, const ComboWeights& opponent) {
+        Board visible;
+        for (int i = 0; i < roundState.getStreet() && i < static_cast<int>(roundState.getDeck().size()); i++) {
+            visible.push_back(roundState.getDeck()[i]);
+        }
+        setBoard(visible);
+        return vsRange(roundState.getHands()[active], opponent);
+    }
+};
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef HAND_EVALUATOR_H
+#define HAND_EVALUATOR_H
+
+#include <array>
+#include <cstdint>
+#include "../game/card.h"
+
+// Ranks sets of up to seven cards. The result orders hands exactly: a larger
+// HandRank wins, equal ranks split. Bits 20-23 hold the category and bits 0-19
+// hold up to five tie-break ranks, most significant first.
+namespace HandEvaluator {
+    using HandRank = std::uint32_t;
+
+    enum class Category {
+        HIGH_CARD,
+        ONE_PAIR,
+        TWO_PAIR,
+        THREE_OF_A_KIND,
+        STRAIGHT,
+        FLUSH,
+        FULL_HOUSE,
+        FOUR_OF_A_KIND,
+        STRAIGHT_FLUSH
+    };
+
+    namespace detail {
+        constexpr int CATEGORY_SHIFT = 20;
+        constexpr int COUNT_SHIFT = 20;
+        constexpr int STRAIGHT_SHIFT = 24;
+        constexpr std::uint32_t KICKER_MASK = 0xFFFFF;
+
+        // Per 13-bit rank mask: straight high rank + 1 (0 if none), number of
+        // ranks present, and the top five ranks packed as nibbles.
+        struct RankTable {
+            std::array<std::uint32_t, 8192> info;
+        };
+
+        constexpr RankTable buildRankTable() {
+            RankTable table{};
+            for (unsigned mask = 0; mask < 8192; mask++) {
+                std::uint32_t kickers = 0;
+                int count = 0;
+                for (int rank = 12; rank >= 0; rank--) {
+                    if ((mask >> rank) & 1) {
+                        if (count < 5) {
+                            kickers |= static_cast<std::uint32_t>(rank) << (16 - 4 * count);
+                        }
+                        count++;
+                    }
+                }
+
+                int straightHigh = 0;
+                for (int high = 12; high >= 4; high--) {
+                    unsigned run = 0x1Fu << (high - 4);
+                    if ((mask & run) == run) {
+                        straightHigh = high + 1;
+                        break;
+                    }
+                }
+                if (straightHigh == 0 && (mask & 0x100Fu) == 0x100Fu) {
+                    straightHigh = 4;
+                }
+
+                table.info[mask] = (static_cast<std::uint32_t>(straightHigh) << STRAIGHT_SHIFT) |
+                                   (static_cast<std::uint32_t>(count) << COUNT_SHIFT) | kickers;
+            }
+            return table;
+        }
+
+        inline constexpr RankTable RANK_TABLE = buildRankTable();
+
+        inline std::uint32_t info(unsigned mask) {
+            return RANK_TABLE.info[mask];
+        }
+
+        inline unsigned topRank(unsigned mask) {
+            return (info(mask) >> 16) & 0xF;
+        }
+
+        inline unsigned countOf(std::uint32_t entry) {
+            return (entry >> COUNT_SHIFT) & 0xF;
+        }
+
+        inline unsigned straightOf(std::uint32_t entry) {
+            return entry >> STRAIGHT_SHIFT;
+        }
+
+        constexpr HandRank make(Category category, std::uint32_t kickers) {
+            return (static_cast<HandRank>(category) << CATEGORY_SHIFT) | kickers;
+        }
+    }
+
+    // Valid for at most seven cards; with more, a flush could mask a better
+    // full house or quads.
+    inline HandRank evaluate(CardSet cards) {
+        using namespace detail;
+        const unsigned s0 = cards.suitMask(0);
+        const unsigned s1 = cards.suitMask(1);
+        const unsigned s2 = cards.suitMask(2);
+        const unsigned s3 = cards.suitMask(3);
+
+        for (unsigned suited : {s0, s1, s2, s3}) {
+            std::uint32_t entry = info(suited);
+            if (countOf(entry) >= 5) {
+                unsigned straight = straightOf(entry);
+                if (straight) {
+                    return make(Category::STRAIGHT_FLUSH, (straight - 1) << 16);
+                }
+                return make(Category::FLUSH, entry & KICKER_MASK);
+            }
+        }
+
+        const unsigned any = s0 | s1 | s2 | s3;
+        const unsigned two = (s0 & s1) | (s2 & s3) | ((s0 | s1) & (s2 | s3));
+        const unsigned three = (s0 & s1 & (s2 | s3)) | (s2 & s3 & (s0 | s1));
+        const unsigned four = s0 & s1 & s2 & s3;
+
+        if (four) {
+            unsigned quad = topRank(four);
+            return make(Category::FOUR_OF_A_KIND, (quad << 16) | (topRank(any ^ (1u << quad)) << 12));
+        }
+
+        if (three) {
+            unsigned trips = topRank(three);
+            unsigned pairs = two & ~(1u << trips);
+            if (pairs) {
+                return make(Category::FULL_HOUSE, (trips << 16) | (topRank(pairs) << 12));
+            }
+        }
+
+        std::uint32_t anyInfo = info(any);
+        if (unsigned straight = straightOf(anyInfo)) {
+            return make(Category::STRAIGHT, (straight - 1) << 16);
+        }
+
+        if (three) {
+            unsigned trips = topRank(three);
+            std::uint32_t kickers = (info(any & ~(1u << trips)) & 0xFF000) >> 4;
+            return make(Category::THREE_OF_A_KIND, (trips << 16) | kickers);
+        }
+
+        if (two) {
+            std::uint32_t pairInfo = info(two);
+            if (countOf(pairInfo) >= 2) {
+                unsigned high = (pairInfo >> 16) & 0xF;
+                unsigned low = (pairInfo >> 12) & 0xF;
+                unsigned rest = any & ~((1u << high) | (1u << low));
+                return make(Category::TWO_PAIR, (pairInfo & 0xFF000) | (topRank(rest) << 8));
+            }
+            unsigned pair = (pairInfo >> 16) & 0xF;
+            std::uint32_t kickers = (info(any & ~(1u << pair)) & 0xFFF00) >> 4;
+            return make(Category::ONE_PAIR, (pair << 16) | kickers);
+        }
+
+        return make(Category::HIGH_CARD, anyInfo & KICKER_MASK);
+    }
+
+    inline HandRank evaluate(const Hand& hand, const Board& board) {
+        return evaluate(hand.getMask() | board.getMask());
+    }
+
+    inline Category getCategory(HandRank rank) {
+        return static_cast<Category>(rank >> detail::CATEGORY_SHIFT);
+    }
+
+    inline const char* getCategoryName(Category category) {
+        switch (category) {
+            case Category::HIGH_CARD: return "High Card";
+            case Category::ONE_PAIR: return "One Pair";
+            case Category::TWO_PAIR: return "Two Pair";
+            case Category::THREE_OF_A_KIND: return "Three of a Kind";
+            case Category::STRAIGHT: return "Straight";
+            case Category::FLUSH: return "Flush";
+            case Category::FULL_HOUSE: return "Full House";
+            case Category::FOUR_OF_A_KIND: return "Four of a Kind";
+            case Category::STRAIGHT_FLUSH: return "Straight Flush";
+        }
+        return "Unknown";
+    }
+}
+
+#endif
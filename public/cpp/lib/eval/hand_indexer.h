@@ -0,0 +1,367 @@
+#ifndef HAND_INDEXER_H
+#define HAND_INDEXER_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include "../game/card.h"
+
+// Suit-isomorphic hand indexing in the style of Waugh's hand indexer. A hand
+// is a sequence of rounds (hole cards, flop, turn, river for hold'em); two
+// hands that differ only by a permutation of suits get the same index, and
+// indices for each round are dense in [0, size(round)).
+//
+// Each suit is summarised by its shape (cards per round) and a suit index
+// (colex rank of its rank sets round by round). Suits are sorted by
+// (shape, suit index); the multiset of shapes selects a configuration and
+// the sorted suit indices of equal-shape suits are ranked as a multiset.
+class HandIndexer {
+private:
+    static constexpr int NUM_SUITS = Card::NUM_SUITS;
+    static constexpr int NUM_RANKS = Card::NUM_RANKS;
+    static constexpr int MAX_ROUNDS = 8;
+
+    using ShapeKey = std::array<std::uint32_t, NUM_SUITS>;
+
+    struct Group {
+        std::uint32_t shape;
+        int count;
+        std::uint64_t suitSize;
+        std::uint64_t radix;
+    };
+
+    struct Configuration {
+        ShapeKey shapes;
+        std::vector<Group> groups;
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    std::vector<int> cardsPerRound;
+    std::vector<std::vector<Configuration>> configurations;
+    std::vector<std::uint64_t> roundSizes;
+
+    static std::uint64_t choose(std::uint64_t n, std::uint64_t k) {
+        if (k > n) {
+            return 0;
+        }
+        if (k == 1) {
+            return n;
+        }
+        std::uint64_t result = 1;
+        for (std::uint64_t i = 1; i <= k; i++) {
+            result = result * (n - k + i) / i;
+        }
+        return result;
+    }
+
+    static int shapeCount(std::uint32_t shape, int round) {
+        return (shape >> (4 * (MAX_ROUNDS - 1 - round))) & 0xF;
+    }
+
+    static std::uint64_t shapeSize(std::uint32_t shape, int rounds) {
+        std::uint64_t size = 1;
+        int used = 0;
+        for (int round = 0; round < rounds; round++) {
+            int count = shapeCount(shape, round);
+            size *= choose(NUM_RANKS - used, count);
+            used += count;
+        }
+        return size;
+    }
+
+    // Colex rank of each round's rank set among the ranks the suit has not
+    // used yet, combined in mixed radix.
+    static std::uint64_t suitIndex(const unsigned* rankSets, int rounds) {
+        std::uint64_t index = 0;
+        std::uint64_t multiplier = 1;
+        unsigned used = 0;
+        for (int round = 0; round < rounds; round++) {
+            unsigned set = rankSets[round];
+            std::uint64_t colex = 0;
+            int i = 0;
+            for (unsigned rest = set; rest; rest &= rest - 1) {
+                int rank = CardBits::lowestBit(rest);
+                int position = CardBits::popcount(~used & ((1u << rank) - 1));
+                colex += choose(position, ++i);
+            }
+            int available = NUM_RANKS - CardBits::popcount(used);
+            index += colex * multiplier;
+            multiplier *= choose(available, CardBits::popcount(set));
+            used |= set;
+        }
+        return index;
+    }
+
+    static void suitUnindex(std::uint32_t shape, int rounds, std::uint64_t index, unsigned* rankSets) {
+        unsigned used = 0;
+        for (int round = 0; round < rounds; round++) {
+            int count = shapeCount(shape, round);
+            int available = NUM_RANKS - CardBits::popcount(used);
+            std::uint64_t radix = choose(available, count);
+            std::uint64_t colex = index % radix;
+            index /= radix;
+
+            unsigned set = 0;
+            for (int i = count; i >= 1; i--) {
+                int position = i - 1;
+                while (choose(position + 1, i) <= colex) {
+                    position++;
+                }
+                colex -= choose(position, i);
+                for (int rank = 0, seen = 0; rank < NUM_RANKS; rank++) {
+                    if (!((used >> rank) & 1) && seen++ == position) {
+                        set |= 1u << rank;
+                        break;
+                    }
+                }
+            }
+            rankSets[round] = set;
+            used |= set;
+        }
+    }
+
+    static std::uint64_t multisetIndex(const std::uint64_t* values, int count) {
+        std::uint64_t index = 0;
+        for (int j = 0; j < count; j++) {
+            index += choose(values[j] + (count - 1 - j), count - j);
+        }
+        return index;
+    }
+
+    static void multisetUnindex(std::uint64_t index, int count, std::uint64_t suitSize, std::uint64_t* values) {
+        for (int j = 0; j < count; j++) {
+            int size = count - j;
+            std::uint64_t offset = count - 1 - j;
+            std::uint64_t low = offset;
+            std::uint64_t high = suitSize - 1 + offset;
+            while (low < high) {
+                std::uint64_t mid = (low + high + 1) / 2;
+                if (choose(mid, size) <= index) {
+                    low = mid;
+                } else {
+                    high = mid - 1;
+                }
+            }
+            index -= choose(low, size);
+            values[j] = low - offset;
+        }
+    }
+
+    void enumerateShapes(int round, int lastRound, std::array<std::uint32_t, NUM_SUITS>& shapes,
+                         std::set<ShapeKey>& found) const {
+        if (round > lastRound) {
+            ShapeKey key = shapes;
+            std::sort(key.begin(), key.end(), std::greater<std::uint32_t>());
+            found.insert(key);
+            return;
+        }
+        std::array<int, NUM_SUITS> counts{};
+        distribute(round, lastRound, 0, cardsPerRound[round], counts, shapes, found);
+    }
+
+    void distribute(int round, int lastRound, int suit, int remaining, std::array<int, NUM_SUITS>& counts,
+                    std::array<std::uint32_t, NUM_SUITS>& shapes, std::set<ShapeKey>& found) const {
+        if (suit == NUM_SUITS - 1) {
+            counts[suit] = remaining;
+            std::array<std::uint32_t, NUM_SUITS> next = shapes;
+            for (int s = 0; s < NUM_SUITS; s++) {
+                int total = counts[s];
+                for (int r = 0; r < round; r++) {
+                    total += shapeCount(shapes[s], r);
+                }
+                if (total > NUM_RANKS) {
+                    return;
+                }
+                next[s] |= static_cast<std::uint32_t>(counts[s]) << (4 * (MAX_ROUNDS - 1 - round));
+            }
+            enumerateShapes(round + 1, lastRound, next, found);
+            return;
+        }
+        for (int count = 0; count <= remaining; count++) {
+            counts[suit] = count;
+            distribute(round, lastRound, suit + 1, remaining - count, counts, shapes, found);
+        }
+    }
+
+    const Configuration& findConfiguration(int round, const ShapeKey& key) const {
+        const auto& list = configurations[round];
+        auto it = std::lower_bound(list.begin(), list.end(), key,
+                                   [](const Configuration& c, const ShapeKey& k) { return c.shapes < k; });
+        return *it;
+    }
+
+public:
+    explicit HandIndexer(std::initializer_list<int> rounds) : cardsPerRound(rounds) {
+        if (cardsPerRound.empty() || cardsPerRound.size() > MAX_ROUNDS) {
+            throw std::invalid_argument("HandIndexer supports 1 to 8 rounds");
+        }
+        for (int round = 0; round < static_cast<int>(cardsPerRound.size()); round++) {
+            std::set<ShapeKey> found;
+            std::array<std::uint32_t, NUM_SUITS> shapes{};
+            enumerateShapes(0, round, shapes, found);
+
+            std::vector<Configuration> list;
+            std::uint64_t offset = 0;
+            for (const ShapeKey& key : found) {
+                Configuration configuration;
+                configuration.shapes = key;
+                configuration.offset = offset;
+                configuration.size = 1;
+                for (int s = 0; s < NUM_SUITS;) {
+                    int e = s;
+                    while (e < NUM_SUITS && key[e] == key[s]) {
+                        e++;
+                    }
+                    Group group;
+                    group.shape = key[s];
+                    group.count = e - s;
+                    group.suitSize = shapeSize(key[s], round + 1);
+                    group.radix = choose(group.suitSize + group.count - 1, group.count);
+                    configuration.size *= group.radix;
+                    configuration.groups.push_back(group);
+                    s = e;
+                }
+                offset += configuration.size;
+                list.push_back(configuration);
+            }
+            configurations.push_back(std::move(list));
+            roundSizes.push_back(offset);
+        }
+    }
+
+    // Hole cards, flop, turn, river.
+    static const HandIndexer& holdem() {
+        static const HandIndexer indexer({2, 3, 1, 1});
+        return indexer;
+    }
+
+    int getNumRounds() const {
+        return static_cast<int>(cardsPerRound.size());
+    }
+
+    int getCardsInRound(int round) const {
+        return cardsPerRound[round];
+    }
+
+    std::uint64_t size(int round) const {
+        return roundSizes[round];
+    }
+
+    // cards holds the cards of rounds 0..round in order; order within a
+    // round does not matter.
+    std::uint64_t index(const Card* cards, int round) const {
+        std::array<std::array<unsigned, MAX_ROUNDS>, NUM_SUITS> rankSets{};
+        std::array<std::uint32_t, NUM_SUITS> shapes{};
+        int position = 0;
+        for (int r = 0; r <= round; r++) {
+            for (int i = 0; i < cardsPerRound[r]; i++, position++) {
+                Card card = cards[position];
+                rankSets[card.getSuit()][r] |= 1u << card.getRank();
+                shapes[card.getSuit()] += 1u << (4 * (MAX_ROUNDS - 1 - r));
+            }
+        }
+
+        std::array<std::pair<std::uint32_t, std::uint64_t>, NUM_SUITS> suits;
+        for (int s = 0; s < NUM_SUITS; s++) {
+            suits[s] = {shapes[s], suitIndex(rankSets[s].data(), round + 1)};
+        }
+        std::sort(suits.begin(), suits.end(), std::greater<std::pair<std::uint32_t, std::uint64_t>>());
+
+        ShapeKey key;
+        for (int s = 0; s < NUM_SUITS; s++) {
+            key[s] = suits[s].first;
+        }
+        const Configuration& configuration = findConfiguration(round, key);
+
+        std::uint64_t index = 0;
+        std::uint64_t multiplier = 1;
+        int s = 0;
+        for (const Group& group : configuration.groups) {
+            std::array<std::uint64_t, NUM_SUITS> values;
+            for (int i = 0; i < group.count; i++) {
+                values[i] = suits[s + i].second;
+            }
+            index += multisetIndex(values.data(), group.count) * multiplier;
+            multiplier *= group.radix;
+            s += group.count;
+        }
+        return configuration.offset + index;
+    }
+
+    // Writes a canonical representative of the given index into cards, round
+    // by round.
+    void unindex(int round, std::uint64_t index, Card* cards) const {
+        if (index >= roundSizes[round]) {
+            throw std::out_of_range("Hand index out of range");
+        }
+        const auto& list = configurations[round];
+        auto it = std::upper_bound(list.begin(), list.end(), index,
+                                   [](std::uint64_t i, const Configuration& c) { return i < c.offset; });
+        const Configuration& configuration = *(it - 1);
+        index -= configuration.offset;
+
+        std::array<std::array<unsigned, MAX_ROUNDS>, NUM_SUITS> rankSets{};
+        int suit = 0;
+        for (const Group& group : configuration.groups) {
+            std::uint64_t groupIndex = index % group.radix;
+            index /= group.radix;
+            std::array<std::uint64_t, NUM_SUITS> values;
+            multisetUnindex(groupIndex, group.count, group.suitSize, values.data());
+            for (int i = 0; i < group.count; i++, suit++) {
+                suitUnindex(group.shape, round + 1, values[i], rankSets[suit].data());
+            }
+        }
+
+        int position = 0;
+        for (int r = 0; r <= round; r++) {
+            for (int s = 0; s < NUM_SUITS; s++) {
+                for (unsigned rest = rankSets[s][r]; rest; rest &= rest - 1) {
+                    cards[position++] = Card(CardBits::lowestBit(rest), s);
+                }
+            }
+        }
+    }
+
+    // Round for a board of 0, 3, 4 or 5 cards under the hold'em layout.
+    static int roundOfBoard(std::size_t boardSize) {
+        switch (boardSize) {
+            case 0: return 0;
+            case 3: return 1;
+            case 4: return 2;
+            case 5: return 3;
+            default: throw std::invalid_argument("Board must have 0, 3, 4 or 5 cards");
+        }
+    }
+
+    std::uint64_t index(const Hand& hole, const Board& board) const {
+        std::array<Card, 7> cards;
+        std::size_t count = 0;
+        for (Card card : hole) {
+            cards[count++] = card;
+        }
+        for (Card card : board) {
+            cards[count++] = card;
+        }
+        return index(cards.data(), roundOfBoard(board.size()));
+    }
+
+    void unindex(int round, std::uint64_t index, Hand& hole, Board& board) const {
+        std::array<Card, 7> cards;
+        unindex(round, index, cards.data());
+        hole.clear();
+        board.clear();
+        int boardCards = round == 0 ? 0 : round + 2;
+        hole.push_back(cards[0]);
+        hole.push_back(cards[1]);
+        for (int i = 0; i < boardCards; i++) {
+            board.push_back(cards[2 + i]);
+        }
+    }
+};
+
+#endif
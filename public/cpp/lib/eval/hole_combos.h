@@ -0,0 +1,72 @@
+#ifndef HOLE_COMBOS_H
+#define HOLE_COMBOS_H
+
+#include <array>
+#include <cstdint>
+#include "../game/card.h"
+
+// Dense indexing of the 1326 two-card holdings. Combo (lo, hi) with card
+// indices lo < hi lives at hi * (hi - 1) / 2 + lo.
+namespace HoleCombos {
+    constexpr int NUM_COMBOS = 1326;
+
+    namespace detail {
+        struct ComboTable {
+            std::array<std::uint8_t, NUM_COMBOS> low;
+            std::array<std::uint8_t, NUM_COMBOS> high;
+            std::array<std::uint64_t, NUM_COMBOS> masks;
+        };
+
+        constexpr ComboTable buildComboTable() {
+            ComboTable table{};
+            int index = 0;
+            for (int high = 1; high < Card::NUM_CARDS; high++) {
+                for (int low = 0; low < high; low++) {
+                    table.low[index] = static_cast<std::uint8_t>(low);
+                    table.high[index] = static_cast<std::uint8_t>(high);
+                    table.masks[index] = CardSet(Card::fromIndex(low)).getBits() |
+                                         CardSet(Card::fromIndex(high)).getBits();
+                    index++;
+                }
+            }
+            return table;
+        }
+
+        inline constexpr ComboTable COMBO_TABLE = buildComboTable();
+    }
+
+    constexpr int indexOf(Card a, Card b) {
+        int low = a.getIndex() < b.getIndex() ? a.getIndex() : b.getIndex();
+        int high = a.getIndex() < b.getIndex() ? b.getIndex() : a.getIndex();
+        return high * (high - 1) / 2 + low;
+    }
+
+    inline int indexOf(const Hand& hand) {
+        return indexOf(hand[0], hand[1]);
+    }
+
+    constexpr Card firstCard(int index) {
+        return Card::fromIndex(detail::COMBO_TABLE.low[index]);
+    }
+
+    constexpr Card secondCard(int index) {
+        return Card::fromIndex(detail::COMBO_TABLE.high[index]);
+    }
+
+    constexpr CardSet getMask(int index) {
+        return CardSet(detail::COMBO_TABLE.masks[index]);
+    }
+
+    inline const std::uint64_t* masks() {
+        return detail::COMBO_TABLE.masks.data();
+    }
+
+    inline Hand toHand(int index) {
+        Hand hand;
+        hand.push_back(firstCard(index));
+        hand.push_back(secondCard(index));
+        return hand;
+    }
+}
+
+#endif
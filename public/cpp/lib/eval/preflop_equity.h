@@ -0,0 +1,60 @@
+#ifndef PREFLOP_EQUITY_H
+#define PREFLOP_EQUITY_H
+
+#include <string>
+#include "../game/card.h"
+#include "preflop_equity_table.h"
+
+// Heads-up all-in equity between the 169 preflop hand classes. Classes are
+// laid out on the usual 13x13 grid: pairs on the diagonal, suited hands at
+// [high][low] and offsuit hands at [low][high], ranks 0..12 for 2..A.
+// Values are averaged over every combo of each class with card removal,
+// so two specific holdings get their class-level equity.
+namespace PreflopEquity {
+    constexpr int NUM_CLASSES = 169;
+
+    constexpr int classOf(int rankA, int rankB, bool suited) {
+        int high = rankA > rankB ? rankA : rankB;
+        int low = rankA > rankB ? rankB : rankA;
+        return suited ? high * 13 + low : low * 13 + high;
+    }
+
+    constexpr int classOf(Card a, Card b) {
+        return classOf(a.getRank(), b.getRank(), a.getSuit() == b.getSuit() && a.getRank() != b.getRank());
+    }
+
+    inline int classOf(const Hand& hand) {
+        return classOf(hand[0], hand[1]);
+    }
+
+    inline std::string className(int handClass) {
+        int row = handClass / 13;
+        int col = handClass % 13;
+        std::string name{Card::rankToChar(row > col ? row : col), Card::rankToChar(row > col ? col : row)};
+        if (row > col) {
+            name += 's';
+        } else if (row < col) {
+            name += 'o';
+        }
+        return name;
+    }
+
+    inline double equity(int heroClass, int opponentClass) {
+        return PreflopEquityTable::EQUITY[heroClass][opponentClass] / 65535.0;
+    }
+
+    inline double equity(const Hand& hero, const Hand& opponent) {
+        return equity(classOf(hero), classOf(opponent));
+    }
+
+    // Equity against a uniformly random opponent hand.
+    inline double equityVsRandom(int heroClass) {
+        return PreflopEquityTable::VS_RANDOM[heroClass] / 65535.0;
+    }
+
+    inline double equityVsRandom(const Hand& hero) {
+        return equityVsRandom(classOf(hero));
+    }
+}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef PREFLOP_EQUITY_TABLE_H
+#define PREFLOP_EQUITY_TABLE_H
+
+// Generated by tools/preflop_table_gen.cpp. Do not edit by hand.
+// Exact heads-up all-in equity of the row class against the column
+// class, scaled by 65535. See preflop_equity.h for the class layout.
+
+#include <cstdint>
+
+namespace PreflopEquityTable {
+    inline constexpr std::uint16_t EQUITY[169][169] = {
+        {32768,43631,43230,42832,43572,44178,43929,43793,43623,43749,43877,44007,43135,41150,12826,34622,34273,34573,34553,35341,35000,34854,34978,35104,35232,34830,40779,32942,12412,33474,33776,33759,34550,34996,34620,34744,34870,34998,34596,40411,32619,31885,12076,32979,32965,33758,34207,34617,34511,34637,34765,34363,41083,32907,32176,31443,12087,32075,32899,33350,33764,34444,34339,34467,34777,41634,32893,32165,31434,30604,11883,32027,32481,32898,33580,34263,34160,34338,41401,33625,32900,32171,31372,30561,12027,31983,32401,33087,33772,34456,34403,41274,33310,33310,32584,31788,30979,30519,11939,31837,32525,33213,33900,34633,41114,33174,32963,32963,32169,31363,30906,30383,11884,31697,32388,33078,33814,41226,33285,33074,32863,32794,31991,31536,31016,30252,11882,32618,33308,34044,41339,33397,33186,32975,32696,32618,32166,31649,30887,31098,11896,33538,34274,41455,33512,33301,33090,32811,32522,32796,32281,31522,31732,31943,11919,34504,40655,33125,32914,32703,33100,32689,32752,32962,32206,32417,32627,32837,11654},
+        {21904,32768,30683,26312,24335,22811,21192,20216,19317,18736,18326,18006,16594,31119,7076,29640,25663,23502,21151,20682,19537,18613,18008,17573,17228,15802,29087,28252,8245,25852,24589,23495,23241,22965,22526,22376,22302,22274,21306,25066,24593,24558,7929,24019,23128,22907,22634,22523,22313,22238,22210,21243,23193,22551,23409,22887,8824,22552,22485,22472,22364,22482,22347,22319,22324,21739,20330,22401,22065,21491,9165,21319,22038,21948,22068,22262,22173,21987,20219,19876,22171,21866,21435,20319,9252,21869,21827,21959,22156,22396,22148,19293,18792,21922,21620,21429,20995,20841,9452,21749,21915,22115,22358,22439,18439,17913,21514,21514,21326,20909,20800,20729,9398,21506,21747,21994,22115,17883,17333,21373,21317,21431,21017,20918,20879,20501,9377,21808,22054,22176,17487,16913,21301,21246,21304,21192,21096,21060,20721,20776,9373,22115,22236,17176,16578,21273,21218,21276,21109,21315,21282,20946,21001,21056,9378,22297,15887,15276,20363,20308,21321,20968,21119,21388,21089,21144,21199,21254,8379},
+        {22305,34852,32768,26386,24433,23139,21520,20257,19616,19035,18625,18305,16889,33120,19557,30359,28989,27317,26363,26106,25226,25078,24929,24854,24826,23996,31120,28798,6946,25175,23312,21054,20595,19536,18724,18120,17685,17340,15914,25143,27449,24149,8028,23814,23057,22837,22669,22633,22422,22348,22320,21352,23293,25919,22383,22707,8961,22715,22650,22508,22511,22629,22494,22466,22462,22050,25047,20248,22016,21658,9536,22134,22073,22292,22413,22606,22518,22331,20530,24815,19804,21818,21603,21094,9625,21905,22172,22304,22500,22740,22493,19332,23992,18796,21654,21463,21029,20876,9454,21785,21951,22151,22394,22475,18716,23853,18021,21626,21472,21238,21129,20763,9687,21772,22013,22260,22381,18160,23712,17441,21430,21578,21346,21247,20913,20750,9667,22074,22321,22442,17764,23640,17021,21358,21451,21521,21425,21095,20969,21024,9663,22381,22503,17453,23612,16686,21330,21423,21438,21644,21316,21194,21249,21304,9667,22563,16160,22834,15384,20420,21460,21297,21448,21422,21337,21392,21447,21502,8669},
+        {22703,39223,39149,32768,24510,23236,21617,20580,19651,19329,18919,18599,17182,37141,19937,32247,30359,27408,26474,26222,25549,25113,25194,25120,25092,24261,37078,30552,19318,29657,26573,25640,25388,25513,24872,24953,24878,24851,24020,31120,28799,28151,6840,22920,20881,20497,19449,18724,18232,17797,17452,16026,23373,26013,25238,22026,9060,22535,22437,22470,22541,22734,22599,22571,22566,22148,25161,24386,20094,21501,9672,22119,22233,22322,22555,22748,22660,22473,20629,24932,24158,19721,21416,21090,9761,22065,22203,22446,22642,22882,22635,19638,24300,24277,18722,21444,21193,21040,9826,21816,22291,22491,22734,22815,18749,23887,23675,18024,21501,21267,21158,20792,9689,21803,22044,22291,22412,18432,23959,23747,17548,21685,21487,21389,21237,20779,9956,22335,22582,22703,18037,23887,23675,17128,21558,21662,21567,21419,20999,21268,9952,22643,22764,17725,23859,23647,16793,21530,21579,21785,21640,21224,21493,21548,9956,22825,16433,23081,22869,15490,21567,21438,21589,21746,21367,21636,21690,21745,8958},
+        {21963,41200,41102,41025,32768,22132,20496,19496,18793,18183,18032,17711,17383,38939,19869,34081,33986,30272,25530,25271,24636,24397,24190,24347,24319,23665,38853,32208,19229,32994,29562,24692,24432,24590,24156,23949,24105,24077,23396,38787,32124,31197,18617,27661,23858,23599,23756,24120,23709,23865,23837,23155,31120,28679,28023,26264,5379,19392,19167,18177,17462,17056,16735,16390,16037,21128,24256,23477,22703,18712,8315,20762,20878,21142,21443,21711,21622,21604,19593,24021,23243,22468,18487,19828,8404,20710,21023,21334,21605,21845,21766,18636,23422,23392,22617,17543,19934,19781,8507,20833,21179,21491,21733,21984,17956,23192,22980,22957,16854,20176,20068,19885,8605,20729,21279,21526,21779,17366,22990,22778,22566,16454,20445,20346,20195,19771,8502,21261,21508,21761,17209,23132,22920,22708,16139,20698,20602,20488,20285,20259,8786,21799,22052,16898,23104,22892,22680,15803,20614,20821,20710,20510,20484,20753,8790,22113,16580,22499,22262,22050,15460,20596,20747,20938,20742,20716,20985,21040,8794},
+        {21357,42724,42396,42299,43403,32768,19509,18492,17826,17442,17003,16941,16381,40332,19912,35173,35057,35857,30194,24541,23927,23726,23717,23585,23788,23082,40034,33190,19249,34063,34863,29477,23703,23853,23456,23447,23316,23518,22812,39949,33088,32159,18618,33877,27571,22865,23015,23411,23207,23075,23278,22572,40973,33832,32903,31980,18195,25030,22295,22445,22841,23434,23098,23301,23219,31120,28577,27915,26150,23783,4249,18002,17129,16456,16061,15825,15593,14975,18681,23322,22544,21766,21223,17404,7352,19550,19872,20359,20735,21049,20753,17708,22743,22686,21908,21366,16569,18702,7455,19720,20241,20621,20938,20971,17062,22546,22309,22278,21736,15920,18999,18850,7591,19988,20409,20767,20803,16680,22527,22290,22078,22286,15529,19445,19328,19087,7723,20391,20947,20983,16250,22395,22157,21945,21965,15290,19784,19670,19467,19441,7637,20929,20965,16178,22581,22343,22131,22151,15059,20080,19969,19804,19961,19935,7928,21256,15650,21927,21689,21477,22082,14479,19816,20007,19844,20001,19975,20244,7733},
+        {21606,44343,44015,43918,45039,46026,32768,18409,17726,17379,17166,16816,16514,41848,20491,36540,36217,36959,37387,30838,24187,23979,24008,24074,23989,23513,41551,34468,19805,35223,35965,36392,30120,24113,23709,23738,23804,23719,23243,41465,34175,33246,19155,34976,35404,27786,23275,23664,23497,23563,23478,23003,42505,34865,33936,33011,18678,34412,25411,22664,23053,23678,23549,23464,23643,43422,35259,34330,33405,32467,18021,22802,21835,22224,22850,23519,23229,23225,31120,29177,28514,26354,24141,21707,4366,17059,16479,16109,15884,15738,15233,17640,22992,22936,22158,21577,20798,16506,7552,19439,19977,20531,20954,21061,16978,22789,22552,22521,21940,21161,15945,18598,7687,19761,20357,20783,20893,16630,22804,22567,22355,22522,21742,15579,19093,18886,7857,20537,20963,21111,16408,22855,22617,22405,22391,22362,15349,19603,19434,19591,8006,20946,21291,16063,22766,22528,22317,22302,22085,15194,19985,19819,19976,19950,7928,21273,15774,22326,22089,21877,22475,22090,14718,20100,19938,20129,20286,20260,8020},
+        {21742,45319,45278,44955,46039,47043,47126,32768,17526,17163,16987,16863,16273,42775,20563,36995,36672,37415,37849,38877,30692,23764,23785,23889,24001,23238,42735,34884,20228,36007,36552,36949,37976,30607,23761,23782,23886,23998,23235,42442,34592,33977,19558,35563,35960,36987,28272,23688,23513,23617,23729,22966,43448,35281,34485,33560,19064,34966,36022,25587,23076,23694,23602,23715,23607,44381,35682,34852,33927,32987,18393,35049,22896,22243,22862,23563,23480,23188,44462,36644,35814,34889,33976,33057,18127,20855,21703,22322,23023,23738,23241,31120,29044,28961,26801,24300,21792,19888,4223,16173,15891,15675,15539,15120,16802,22600,22600,22543,21963,21179,20674,15664,7498,19239,19859,20460,20675,16438,22608,22608,22370,22537,21754,21249,15381,18410,7668,20076,20677,20892,16251,22693,22693,22455,22441,22405,21900,15159,18981,19173,7854,20857,21072,16113,22787,22787,22549,22535,22318,22564,15014,19535,19726,19883,8011,21055,15551,22073,22073,21835,22433,22048,22105,14614,19735,19927,20083,20057,7734},
+        {21912,46218,45919,45884,46742,47709,47809,48009,32768,16959,16766,16679,16353,43629,20709,37144,37109,37653,38050,39085,39009,30692,23627,23724,23874,23346,43352,35026,20314,36224,36768,37165,38200,38972,30461,23563,23659,23809,23281,43317,34991,34173,19996,36108,36308,37305,38077,28759,23561,23657,23807,23279,44114,35499,34681,34071,19485,35314,36339,37111,25975,23713,23614,23764,23891,45013,35865,35048,34255,33316,18801,35364,36136,23057,22881,23575,23529,23472,45110,36834,36016,35190,34277,33356,18524,35455,20949,22337,23030,23778,23525,45298,36768,36735,35909,34997,34075,33434,18025,19082,21566,22260,23007,23544,31120,29044,28828,27249,24658,21938,19973,18227,4127,15554,15443,15316,14907,16260,22472,22416,22416,22557,21774,21265,20546,15071,7497,19397,20022,20441,16056,22550,22494,22494,22454,22418,21909,21190,14949,18554,7683,20240,20658,15953,22678,22623,22622,22582,22365,22604,21885,14812,19131,19322,7878,20875,15633,22181,22125,22125,22698,22312,22370,22394,14422,19527,19718,19909,7873},
+        {21786,46799,46500,46206,47352,48093,48156,48372,48576,32768,16517,16430,16103,44183,20557,37293,37028,37860,38059,39057,38988,39146,30692,23501,23652,23124,43906,35164,20140,36143,36975,37174,38172,38951,38879,30461,23437,23587,23059,43633,34918,34100,19765,36095,36295,37292,38071,38847,28613,23374,23524,22996,44689,35684,34866,34052,19609,35630,36458,37199,37976,26443,23598,23748,23874,45380,35869,35051,34237,33612,18910,35482,36224,37000,23366,23529,23484,23427,45442,36803,35985,35172,34392,33470,18623,35541,36317,21096,22985,23733,23480,45647,36744,36711,35897,35083,34162,33519,18116,35580,19176,22211,22958,23498,45841,36895,36651,36622,35808,34886,34243,33548,17603,17586,21211,21958,22499,31120,29043,28828,27115,25088,22222,20105,18311,16824,3898,15329,15203,14794,15826,22344,22288,22233,22430,22368,21860,21137,20206,14844,7396,20009,20427,15722,22472,22417,22361,22558,22315,22554,21831,20900,14707,19108,7591,20645,15402,21975,21919,21864,22674,22263,22320,22345,21414,14317,19504,19695,7586},
+        {21658,47209,46910,46616,47503,48532,48369,48548,48769,49018,32768,16176,15850,44577,20403,37368,37102,37704,38191,38991,38884,39049,39271,30692,23425,22897,44300,35232,19964,36217,36819,37306,38106,38847,38782,39005,30461,23361,22833,44027,34986,34168,19570,35939,36426,37226,37968,38751,38743,28613,23298,22770,44845,35541,34723,33910,19359,35542,36370,37111,37895,38735,26298,23460,23587,45794,35984,35166,34352,33524,19019,35723,36267,37013,37853,23797,23463,23407,45648,36736,35919,35105,34304,33697,18719,35584,36330,37170,21344,23683,23431,45819,36643,36610,35797,34995,34207,33564,18204,35590,36430,19309,22909,23449,46028,36801,36557,36528,35726,34903,34261,33563,17686,35446,17680,21905,22445,46257,37004,36759,36519,36502,35679,35037,34339,33416,17628,16881,21966,22506,31120,29042,28827,27115,24954,22617,20332,18431,16908,16151,3696,15090,14681,15488,22262,22207,22151,22293,22288,22501,21778,20843,20898,14603,7304,20414,15168,21765,21709,21654,22409,22235,22266,22291,21356,21411,14213,19481,7300},
+        {21528,47529,47230,46936,47824,48594,48719,48672,48856,49105,49359,32768,15592,44886,20247,37395,37130,37732,37988,39076,38771,38899,39121,39348,30692,22667,44609,35257,19786,36245,36847,37103,38191,38735,38632,38855,39081,30461,22603,44337,35011,34193,19372,35967,36224,37311,37855,38601,38593,38819,28613,22539,45155,35566,34748,33935,19145,35339,36455,36999,37745,38585,38581,26298,23357,45866,35798,34980,34166,33338,18753,35588,36132,36878,37719,38563,23651,23115,45978,36808,35991,35177,34376,33565,18815,35778,36289,37129,37974,21719,23406,45941,36534,36500,35687,34886,34075,33747,18291,35549,36389,37234,19514,23396,46116,36657,36413,36384,35582,34772,34228,33531,17767,35403,36248,17799,22392,46345,36860,36615,36375,36358,35548,35004,34307,33382,17706,36474,16975,22453,46577,37066,36822,36582,36354,36328,35784,35087,34162,34368,17691,16349,22514,31120,29042,28827,27114,24953,22484,20677,18618,17014,16235,15638,3521,14567,14930,21551,21495,21440,22195,21966,22235,22234,21299,21354,21409,14109,7013},
+        {22400,48941,48646,48353,48152,49154,49021,49262,49182,49432,49685,49943,32768,46236,20419,38083,37817,38233,38816,39673,39657,39549,39771,39998,40228,30769,45963,35917,19936,36932,37353,37935,38792,39624,39287,39509,39735,39965,30545,45691,35671,34853,19503,36473,37056,37912,38744,39255,39247,39473,39704,28703,45471,36050,35236,34422,19606,35356,36393,37225,37736,38576,38572,38803,27090,46405,36596,35782,34969,33353,19499,35746,36578,37089,37929,38773,38774,24551,46279,37395,36582,35768,34326,33727,19512,36004,36515,37355,38199,39048,22473,46500,37379,37349,36536,35094,34495,33963,19352,35869,36709,37553,38402,20715,46433,37286,37046,37017,35575,34976,34444,33846,18821,35722,36567,37415,18880,46662,37489,37249,37008,36351,35752,35220,34622,33697,18758,36793,37641,17979,46894,37696,37455,37215,36346,36532,36000,35402,34477,34683,18743,37872,17343,47131,37906,37666,37426,36557,36532,36785,36186,35261,35468,35678,18776,16986,31120,29143,28936,27228,25687,23324,21385,19736,18020,17169,16562,16212,4446},
+        {24385,34416,32415,28394,26596,25203,23687,22760,21906,21352,20958,20649,19299,32768,10399,31574,27913,25946,23786,23331,22246,21368,20789,20371,20037,18673,30895,30111,11016,28003,26886,25906,25704,25453,25043,24904,24836,24811,23881,27214,26757,26241,10719,26346,25554,25382,25133,25040,24844,24775,24750,23820,25516,24906,25195,24692,11552,25005,24976,24967,24876,24997,24870,24845,24863,24186,22866,24268,23941,23400,11866,23884,24550,24476,24599,24790,24707,24537,22764,22424,24078,23780,23373,22315,11954,24389,24360,24494,24687,24921,24693,21883,21396,23846,23550,23370,22960,22811,12137,24274,24439,24636,24872,24962,21071,20561,23459,23458,23280,22887,22780,22702,12086,24048,24283,24523,24649,20539,20005,23326,23272,23390,22998,22901,22853,22487,12066,24340,24581,24707,20159,19601,23259,23205,23269,23173,23079,23034,22704,22758,12062,24639,24765,19858,19276,23234,23180,23244,23094,23295,23253,22926,22980,23033,12066,24823,18629,18035,22351,22297,23284,22953,23100,23354,23061,23115,23168,23222,11133},
+        {52709,58459,45978,45598,45666,45623,45044,44972,44826,44978,45132,45288,45116,55136,32768,42611,42236,43009,43654,44286,44064,43919,44070,44222,44377,43519,43648,40229,12445,34289,34639,34822,34826,35639,35285,35431,35579,35729,35349,43295,39882,32637,12109,33842,34027,34035,34850,35282,35198,35346,35496,35117,43361,40585,32973,32240,12157,33165,33175,33993,34429,35131,35049,35199,35558,43324,41171,33154,32423,31621,12199,32305,33153,33591,34296,35001,34921,35120,42780,41747,33163,32435,31635,30824,12045,32282,32723,33431,34138,34844,34813,42711,41541,33918,33192,32396,31615,30803,12231,32224,32935,33645,34354,35109,42575,41404,33592,33591,32797,32019,31210,30751,12176,32107,32820,33532,34290,42713,41539,33723,33512,33443,32668,31861,31404,30640,12174,33050,33762,34520,42852,41676,33856,33645,33366,33316,32512,32058,31296,31507,12188,33991,34750,42994,41815,33992,33781,33501,33240,33162,32710,31952,32162,32372,12211,34980,42827,41028,33625,33414,33838,33428,33139,33413,32656,32867,33077,33288,11946},
+        {30913,35895,35176,33288,31454,30362,28995,28540,28391,28242,28167,28140,27452,33961,22924,32768,26465,24514,23221,22321,21167,20525,19945,19535,19214,17798,33315,31125,8159,25540,23843,22391,20668,20666,19858,19256,18824,18481,17049,31460,25253,24529,8378,24571,23942,23484,23643,23606,23395,23321,23293,22325,29774,23405,22912,23436,9339,23622,23297,23481,23484,23602,23467,23439,23456,28769,22162,21525,22868,22531,10087,22781,23068,23287,23408,23601,23512,23326,27462,21278,19876,22444,22230,21720,10478,21942,22859,22992,23188,23428,23180,27039,20187,19854,22595,22404,21991,20911,10607,22713,22879,23079,23322,23403,26901,19571,19082,22567,22413,22199,21771,21638,10840,22700,22941,23188,23309,26759,19015,18505,22370,22518,22307,21890,21787,21624,10820,23002,23249,23370,26687,18619,18088,22298,22391,22482,22068,21969,21844,21899,10816,23309,23430,26659,18308,17755,22270,22363,22399,22286,22190,22069,22124,22179,10820,23491,26020,17015,16446,21360,22421,22258,22090,22297,22212,22267,22322,22377,9822},
+        {31262,39872,36546,35176,31549,30478,29318,28863,28426,28507,28433,28405,27718,37622,23299,39070,32768,24587,23314,22644,21489,20561,20239,19829,19508,18092,34563,37036,19853,30413,27446,26519,26207,26364,25723,25804,25730,25702,24871,33315,31126,28889,8058,23451,22219,20571,20579,19857,19368,18936,18594,17161,29871,23481,26079,22556,9437,23442,23257,23443,23515,23707,23572,23544,23561,28886,22256,25233,21370,22374,10223,22939,23228,23317,23550,23743,23654,23468,27769,21584,24951,19793,22209,21883,10848,22752,22890,23331,23527,23767,23520,27347,20493,25099,19780,22385,22154,21682,10979,22744,23219,23419,23661,23743,26934,19604,24497,19085,22442,22228,21801,21667,10842,22731,22972,23219,23340,27006,19287,24570,18611,22625,22448,22214,22112,21653,11109,23263,23510,23631,26935,18892,24498,18194,22498,22623,22391,22293,21873,22142,11105,23570,23692,26906,18580,24470,17862,22470,22540,22610,22515,22098,22367,22422,11109,23752,26267,17288,23692,16553,22528,22399,22414,22621,22241,22510,22565,22620,10111},
+        {30962,42033,38218,38127,35263,29678,28576,28120,27882,27675,27831,27803,27302,39589,22526,41021,40948,32768,22209,21560,20406,19702,19093,18941,18621,18292,36062,38809,19763,33953,30323,25571,25280,25441,25007,24800,24956,24929,24243,35982,38746,32121,19151,28002,24738,24447,24607,24971,24560,24716,24688,24002,33364,31126,28766,26619,6601,20730,19240,19307,18595,18192,17873,17531,17181,28119,21237,24324,23549,19989,8867,21610,21873,22137,22438,22706,22617,22599,27055,20582,24063,23288,18559,20648,9529,21595,21908,22219,22527,22767,22688,26633,19492,24214,23440,18601,20895,20606,9660,21761,22107,22419,22661,22911,26403,18811,23803,23779,17915,21138,20893,20759,9758,21657,22207,22454,22707,26201,18221,23601,23389,17518,21406,21171,21069,20645,9655,22189,22436,22689,26343,18064,23743,23531,17205,21659,21461,21363,21160,21134,9939,22727,22980,26315,17753,23715,23503,16872,21576,21680,21584,21385,21359,21628,9943,23040,25850,17435,23081,22869,16532,21557,21606,21813,21616,21590,21859,21914,9947},
+        {30982,44384,39172,39061,40005,35341,28148,27686,27485,27476,27344,27547,26719,41749,21881,42314,42221,43326,32768,20572,19401,18735,18351,17912,17850,17290,36912,39989,19784,35022,35823,30243,24550,24704,24307,24298,24167,24369,23659,36813,39909,33082,19153,34836,27920,23713,23866,24263,24058,23926,24129,23419,37696,40933,33827,32904,18729,25554,23143,23296,23692,24286,23949,24152,24092,33411,31126,28662,26512,24307,5471,18076,18260,17590,17197,16964,16735,16119,26640,19670,23364,22586,22043,17476,8477,20472,20794,21281,21657,21971,21675,26211,18563,23509,22731,22188,17628,19561,8608,20648,21169,21548,21865,21898,26015,17917,23131,23101,22558,16981,19858,19724,8744,20916,21337,21695,21731,25996,17535,23112,22900,23109,16594,20305,20203,19961,8876,21319,21875,21911,25864,17105,22980,22768,22788,16357,20643,20544,20341,20315,8790,21857,21893,26049,17033,23166,22954,22974,16128,20939,20844,20678,20835,20809,9081,22184,25278,16505,22508,22296,22925,15551,20675,20881,20719,20876,20850,21119,8886},
+        {30194,44853,39429,39313,40264,40994,34697,26658,26450,26478,26544,26459,25862,42204,21249,43214,42891,43975,44963,32768,18409,17726,17380,17166,16817,16515,37116,40812,19802,35471,36251,36859,30166,23970,23594,23622,23689,23603,23124,37014,40519,33474,19152,35262,35870,27835,23132,23521,23354,23420,23335,22856,37903,41525,34200,33275,18712,34907,25463,22558,22947,23572,23443,23358,23528,38588,42442,34767,33842,32932,18300,22857,21965,22354,22979,23648,23358,23354,32817,31126,28560,26403,24192,21762,4368,17136,16558,16191,15969,15826,15323,25266,17647,22806,22028,21482,20919,16581,7556,19476,20014,20569,20991,21098,25063,16984,22448,22391,21845,21282,16022,18634,7692,19799,20394,20821,20931,25078,16636,22463,22225,22426,21864,15659,19129,18922,7862,20574,21000,21148,25128,16415,22513,22276,22296,22484,15432,19639,19470,19627,8011,20983,21328,25040,16069,22425,22187,22207,22206,15279,20021,19856,20013,19987,7933,21310,24482,15780,21981,21743,22372,22211,14806,20136,19974,20165,20322,20296,8025},
+        {30535,45998,40309,39986,40899,41608,41348,34843,26526,26547,26651,26764,25878,43289,21471,44368,44046,45129,46134,47126,32768,17639,17276,17099,16975,16386,37933,41900,20357,36425,36998,37548,37980,30809,23850,23872,23975,24088,23320,37640,41607,34372,19686,36009,36559,36991,28361,23777,23603,23706,23819,23052,38495,42613,34907,33982,19230,35594,36025,25701,23203,23821,23729,23842,23724,39160,43546,35420,34495,33583,18766,35053,23238,22568,23187,23887,23805,23513,38917,44468,35818,34894,33981,33062,18131,20913,21740,22359,23059,23775,23278,32952,31126,29159,26894,24417,22119,19945,4512,16510,16231,16018,15885,15468,25142,16913,22693,22637,22090,21490,20710,15980,7788,19506,20126,20727,20942,25151,16549,22702,22464,22665,22064,21285,15699,18660,7958,20343,20944,21160,25236,16361,22786,22549,22569,22715,21936,15481,19231,19422,8145,21124,21340,25330,16224,22880,22643,22663,22628,22599,15338,19785,19976,20133,8302,21322,24497,15662,22162,21924,22554,22358,22141,14941,19985,20176,20333,20307,8024},
+        {30681,46922,40457,40422,41138,41809,41556,41771,34843,26389,26486,26636,25986,44167,21616,45010,44974,45833,46800,47809,47896,32768,17071,16878,16792,16465,38075,42517,20442,36642,37215,37764,38203,39235,30664,23652,23749,23899,23367,38040,42482,34568,20125,36555,36907,37308,38340,28848,23650,23747,23897,23365,38713,43279,35103,34492,19651,35941,36343,37374,26089,23840,23741,23891,24008,39344,44178,35616,34824,33911,19174,35368,36428,23399,23206,23899,23854,23797,39107,45116,36021,35195,34282,33361,18527,35459,21007,22373,23067,23814,23562,39311,45201,36987,36161,35249,34354,33439,18288,19401,21834,22527,23275,23811,32952,31126,29026,27342,24774,22266,20030,18526,4415,15894,15785,15662,15255,25014,16370,22510,22509,22685,22084,21301,20796,15390,7787,19664,20290,20708,25092,16167,22588,22588,22582,22729,21945,21440,15270,18804,7974,20507,20925,25220,16063,22716,22716,22710,22675,22640,22134,15136,19381,19572,8168,21143,24605,15743,22215,22215,22818,22623,22405,22644,14748,19777,19968,20159,8164},
+        {30557,47527,40606,40341,41345,41818,41527,41750,41908,34843,26264,26414,25764,44746,21465,45590,45296,46442,47184,48155,48259,48464,32768,16629,16542,16216,38213,43071,20268,36561,37422,37774,38175,39214,39142,30664,23527,23677,23144,37967,42799,34495,19894,36542,36894,37295,38334,39111,28702,23463,23613,23081,38898,43854,35288,34474,19775,36257,36461,37463,38239,26558,23724,23874,23992,39347,44545,35619,34806,34208,19284,35486,36516,37292,23708,23854,23809,23752,39076,45448,35990,35176,34397,33475,18626,35545,36321,21154,23022,23769,23517,39287,45549,36963,36149,35336,34441,33524,18379,35645,19495,22478,23225,23766,39438,45743,36903,36874,36060,35166,34248,33612,17865,17908,21478,22226,22766,32952,31126,29026,27208,25204,22549,20162,18610,17125,4187,15672,15548,15142,24886,15936,22382,22326,22558,22679,21895,21387,20456,15166,7687,20276,20695,25014,15833,22510,22455,22686,22626,22590,22081,21150,15032,19358,7882,20912,24399,15513,22009,21953,22794,22573,22356,22594,21664,14644,19754,19945,7877},
+        {30431,47962,40681,40415,41188,41950,41461,41646,41811,42034,34843,26187,25537,45164,21313,46000,45706,46594,47623,48369,48436,48657,48906,32768,16289,15963,38281,43465,20092,36636,37266,37905,38109,39111,39046,39268,30664,23450,22918,38035,43192,34563,19698,36386,37026,37229,38231,39014,39006,28702,23387,22855,38755,44010,35145,34331,19525,36169,36373,37374,38158,38998,26412,23587,23704,39462,44959,35734,34921,34120,19392,35726,36559,37305,38145,24139,23788,23731,39010,45655,35924,35110,34309,33702,18723,35588,36334,37174,21402,23720,23468,39186,45721,36862,36049,35248,34486,33569,18467,35655,36495,19628,23176,23717,39344,45931,36809,36780,35979,35183,34265,33627,17948,35511,18002,22172,22713,39546,46159,37011,36771,36754,35959,35041,34403,33480,17890,17206,22233,22774,32951,31126,29025,27208,25071,22945,20389,18729,17209,16455,3985,15435,15029,24804,15598,22300,22245,22421,22598,22536,22028,21093,21148,14927,7595,20681,24189,15278,21799,21743,22529,22545,22302,22541,21606,21661,14540,19731,7590},
+        {30303,48307,40709,40443,41216,41747,41546,41534,41661,41883,42110,34843,25307,45498,21158,46321,46027,46914,47685,48718,48560,48743,48993,49246,32768,15705,38306,43774,19914,36664,37293,37702,38194,38998,38896,39118,39344,30664,22688,38060,43502,34588,19501,36414,36823,37314,38118,38864,38856,39082,28702,22625,38780,44320,35170,34357,19311,35966,36458,37262,38008,38848,38844,26412,23474,39276,45031,35548,34735,33934,19126,35592,36424,37170,38010,38855,23994,23440,39081,45984,35995,35182,34381,33570,18818,35782,36293,37133,37977,21777,23443,39076,45843,36752,35939,35138,34355,33752,18553,35614,36454,37299,19833,23663,39200,46019,36665,36636,35835,35052,34233,33594,18029,35468,36313,18120,22659,39402,46247,36867,36627,36610,35828,35009,34370,33445,17969,36539,17300,22720,39609,46480,37074,36834,36606,36608,35789,35150,34225,34432,17953,16676,22781,32951,31126,29025,27207,25070,22811,20734,18917,17315,16539,15944,3810,14916,23975,15040,21585,21529,22315,22276,22271,22484,21549,21604,21659,14436,7304},
+        {30705,49733,41539,41274,41870,42453,42022,42297,42189,42411,42638,42868,34766,46862,22016,47737,47443,47243,48245,49020,49149,49070,49319,49572,49830,32768,39104,45128,20065,37351,37951,38534,38795,39887,39550,39772,39998,40228,30743,38858,44856,35248,19632,37072,37655,37916,39008,39518,39510,39737,39967,28784,39410,44637,35804,34991,19979,36136,36397,37516,38027,38867,38864,39094,27430,39956,45570,36351,35537,34095,19872,35750,36869,37380,38221,39065,39065,24894,39551,46286,36587,35773,34331,33732,19515,36008,36519,37359,38203,39052,22531,39804,46402,37601,36788,35373,34774,33968,19614,35934,36774,37618,38467,21034,39711,46336,37298,37269,35854,35255,34449,33909,19084,35787,36632,37480,19202,39914,46564,37501,37260,36630,36031,35225,34685,33760,19020,36858,37706,18303,40121,46797,37707,37467,36626,36811,36005,35465,34540,34747,19005,37937,17670,40331,47034,37918,37678,36836,36811,36789,36249,35324,35531,35742,19038,17316,32904,31126,29129,27314,26011,23652,21442,20035,18322,17473,16869,16522,4735},
+        {24756,36448,34415,28457,26682,25501,23984,22800,22183,21629,21235,20926,19572,34640,21887,32220,30972,29473,28623,28419,27602,27460,27322,27254,27229,26431,32768,30636,10273,27453,25761,23688,23243,22244,21469,20891,20473,20139,18775,27281,29038,26342,10809,26136,25467,25297,25168,25138,24941,24873,24848,23918,25603,27630,24743,24505,11677,25134,25107,25002,25008,25129,25002,24977,24986,24467,26831,22785,23876,23538,12209,24615,24585,24789,24913,25103,25020,24851,23045,26639,22352,23716,23513,23032,12296,24424,24673,24807,25000,25234,25007,21920,25862,21399,23584,23403,22994,22844,12139,24309,24475,24671,24908,24997,21327,25729,20659,23560,23414,23191,23084,22736,12353,24294,24529,24769,24895,20795,25596,20104,23373,23523,23303,23206,22887,22721,12334,24587,24827,24953,20415,25529,19699,23306,23402,23478,23383,23068,22938,22991,12330,24885,25011,20113,25504,19374,23281,23377,23399,23600,23287,23160,23213,23267,12333,25069,18881,24749,18133,22398,23410,23257,23405,23387,23295,23349,23402,23456,11400},
+        {32593,37283,36737,34983,33327,32345,31067,30651,30509,30371,30303,30278,29618,35424,25306,34410,28499,26726,25546,24723,23635,23018,22464,22070,21761,20407,34899,32768,11391,27770,26229,24903,23316,23292,22520,21944,21529,21198,19827,32917,27353,26670,11136,26842,26296,25901,26079,26048,25852,25783,25758,24828,31357,25677,25205,25190,12031,25984,25711,25912,25918,26039,25913,25887,25917,30429,24542,23937,24681,24363,12729,25219,25516,25720,25844,26034,25951,25782,29199,23730,22418,24303,24101,23620,13090,24462,25311,25444,25637,25871,25644,28805,22700,22371,24471,24290,23900,22876,13217,25170,25335,25532,25768,25858,28672,22107,21634,24446,24300,24098,23694,23564,13432,25154,25389,25630,25756,28539,21575,21081,24260,24409,24209,23816,23715,23549,13412,25447,25688,25814,28473,21195,20679,24193,24289,24385,23993,23896,23766,23819,13408,25745,25872,28447,20894,20357,24168,24263,24305,24209,24115,23988,24042,24095,13411,25930,27827,19661,19109,23285,24317,24164,24015,24215,24123,24177,24230,24284,12479},
+        {53123,57290,58589,46217,46306,46286,45730,45307,45221,45395,45571,45749,45599,54519,53090,57376,45682,45772,45751,45733,45178,45093,45267,45443,45621,45470,55262,54144,32768,41611,42411,43084,43753,44410,44175,44348,44523,44700,43858,43881,43376,39322,12139,34655,34885,35090,35116,35912,35847,36014,36184,35823,43967,43462,40051,32989,12187,34023,34230,34259,35058,35780,35717,35886,36265,43951,43447,40663,33214,32412,12267,33388,33419,34221,34945,35669,35608,35827,43428,43433,41273,33415,32616,31832,12359,32549,33382,34109,34835,35561,35549,43028,42912,41872,33444,32648,31867,31056,12247,32511,33241,33970,34698,35473,42949,42832,41654,34186,33392,32613,31832,31021,12466,32479,33211,33942,34720,43107,42990,41809,34124,34056,33280,32502,31693,30992,12464,33441,34172,34949,43267,43151,41967,34276,33996,33946,33170,32364,31666,31876,12478,34402,35179,43430,43313,42127,34429,34150,33889,33839,33035,32339,32550,32760,12501,35409,43284,43167,41355,34081,34505,34094,33833,33755,33062,33273,33483,33694,12236},
+        {32061,39683,40360,35878,32541,31472,30312,29528,29311,29392,29318,29290,28603,37532,31246,39995,35122,31582,30513,30064,29110,28893,28974,28899,28871,28184,38082,37765,23924,32768,24666,23395,22725,22291,21470,21148,20738,20418,19001,33977,33301,31130,9270,23836,22747,21906,20650,20985,20499,20070,19730,18294,30828,29930,23589,22952,9786,24194,24138,24085,24483,24675,24540,24512,24529,29845,28947,22367,21897,23098,10600,23840,23869,24285,24518,24711,24622,24436,28729,28533,21694,21067,23056,22750,11399,23394,23879,24321,24517,24757,24509,27968,27606,21238,19850,23005,22775,22303,11831,22775,23901,24101,24344,24425,27766,27405,20457,20140,23377,23163,22756,21697,11994,23653,23895,24141,24263,27838,27477,20140,19669,23560,23383,23169,22749,22522,12261,24186,24432,24554,27767,27406,19745,19255,23433,23558,23347,22930,22742,23011,12257,24493,24614,27738,27377,19433,18925,23405,23475,23566,23151,22967,23236,23291,12261,24675,27099,26738,18141,17614,23463,23334,23370,23258,23110,23379,23434,23489,11263},
+        {31759,40946,42223,38962,35973,30672,29570,28983,28767,28560,28716,28688,28182,38649,30896,41692,38089,35212,29712,29284,28537,28320,28113,28269,28242,27584,39774,39306,23124,40869,32768,22286,21637,21432,20612,20002,19850,19530,19202,36789,35972,38702,19684,28641,25606,25321,25422,25817,25406,25562,25534,24848,34033,33353,31130,27247,7818,21258,20575,19378,19723,19323,19007,18667,18320,29078,28180,21343,24385,20516,9243,22511,22687,23105,23406,23674,23585,23567,28015,27786,20689,24129,19832,21515,10080,22410,22897,23209,23517,23756,23678,27436,27049,20444,24228,18671,21683,21393,10747,22443,22789,23298,23541,23791,27235,26848,19664,24596,18971,22073,21848,21396,10910,22579,23130,23376,23629,27033,26646,19074,24206,18576,22341,22127,21706,21514,10807,23112,23358,23611,27175,26789,18917,24348,18266,22594,22417,22182,22029,22003,11091,23650,23902,27147,26760,18606,24320,17936,22511,22636,22404,22254,22228,22497,11095,23963,26678,26152,18287,23686,17598,22492,22562,22632,22485,22459,22728,22783,11099},
+        {31776,42040,44481,39895,40843,36058,29143,28586,28370,28361,28229,28432,27600,39629,30713,43144,39016,39964,35292,28676,27987,27771,27761,27630,27833,27001,41847,40632,22451,42140,43249,32768,20649,20465,19644,19260,18821,18759,18199,37619,36797,39862,19686,35794,28564,24587,24709,25109,24904,24772,24975,24265,38506,37684,40890,33826,19262,25917,24017,24139,24538,25132,24795,24998,24938,34087,33402,31130,27146,24682,6692,19411,18331,18718,18328,18098,17872,17258,27600,27205,19776,23426,22884,18750,9028,21315,21784,22271,22646,22961,22665,27048,26522,19550,23546,23003,17697,20375,9732,21528,22048,22428,22782,22815,26847,26321,18770,23918,23376,18037,20813,20544,9896,21839,22259,22618,22654,26828,26301,18387,23718,23926,17652,21260,21022,20830,10028,22242,22798,22833,26696,26169,17958,23585,23605,17418,21598,21364,21210,21184,9942,22780,22816,26882,26355,17886,23771,23791,17192,21895,21697,21547,21704,21678,10233,23107,26106,25579,17358,23113,23743,16618,21631,21735,21588,21745,21719,21988,10038},
+        {30985,42294,44940,40147,41103,41832,35415,27559,27335,27363,27429,27344,26743,39831,30709,44867,39328,40255,40985,35369,27555,27332,27360,27426,27341,26740,42292,42219,21782,42810,43898,44886,32768,19472,18635,18289,18075,17726,17424,37820,37056,40472,19685,36220,36828,28484,23975,24367,24200,24266,24181,23702,38713,37923,41482,34197,19245,35865,25835,23400,23793,24418,24289,24204,24374,39399,38609,42400,34764,33854,18833,23380,22807,23200,23825,24494,24204,24200,33494,33450,31130,27042,24575,22284,5590,17207,17687,17323,17103,16963,16463,26103,26102,18634,22843,22296,21734,16650,8680,20393,20931,21485,21908,22015,25895,25894,17837,23209,22662,22100,17079,19488,8844,20721,21317,21743,21853,25910,25909,17489,23042,23243,22681,16718,19983,19791,9014,21497,21923,22071,25961,25960,17267,23093,23113,23301,16493,20493,20339,20496,9163,21906,22250,25872,25871,16922,23004,23024,23024,16343,20875,20725,20882,20856,9085,22233,25310,25310,16633,22560,23190,23028,15873,20990,20843,21034,21191,21165,9177},
+        {30539,42570,45999,40022,40945,41682,41422,34928,26563,26584,26688,26800,25911,40082,29896,44869,39171,40094,40831,41565,34726,26300,26321,26424,26537,25648,43291,42243,21125,43244,44103,45070,46063,32768,17639,17276,17100,16976,16386,37673,36880,40867,19682,36257,36844,37456,28407,23629,23482,23586,23699,22931,38537,37744,41664,34209,19225,35878,36490,25750,23054,23673,23581,23693,23576,39229,38436,42563,34757,33845,18799,35546,23290,22457,23075,23776,23694,23401,38986,39126,43485,35329,34417,33524,18408,20968,21864,22483,23183,23899,23402,33036,32856,31130,26940,24466,22170,19999,4514,16584,16308,16097,15967,15553,25177,24945,16917,22502,21955,21389,20826,16052,7792,19538,20158,20759,20974,25185,24953,16553,22354,22530,21963,21401,15774,18691,7962,20375,20976,21192,25270,25038,16365,22439,22433,22614,22052,15558,19262,19453,8148,21156,21372,25364,25132,16228,22533,22527,22527,22716,15418,19816,20007,20164,8305,21354,24528,24296,15666,21815,22419,22257,22257,15024,20016,20207,20364,20338,8028},
+        {30915,43009,46811,40663,41379,42079,41826,41774,35074,26656,26753,26903,26248,40492,30250,45677,39812,40528,41228,41941,41685,34871,26393,26489,26639,25985,44066,43015,21360,44065,44923,45891,46900,47896,32768,17184,16991,16904,16578,38270,37477,41645,20252,36972,37352,37906,38342,29032,23735,23831,23981,23449,38943,38150,42442,34886,19778,36387,36941,37377,26178,23924,23825,23975,24093,39601,38808,43341,35244,34332,19339,35994,36430,23513,23327,24021,23975,23919,39364,39477,44279,35761,34849,33955,18900,35462,21350,22693,23387,24134,23882,39314,39238,45205,36164,35252,34358,33442,18290,19459,21865,22559,23306,23842,33171,32991,31130,27522,24867,22382,20356,18582,4703,16229,16123,16002,15599,25262,25030,16478,22597,22773,22206,21606,20826,15703,8077,19927,20552,20970,25340,25108,16275,22675,22669,22851,22250,21470,15586,19049,8263,20769,21188,25469,25236,16172,22804,22798,22798,22945,22165,15455,19625,19816,8458,21405,24850,24617,15851,22302,22906,22745,22710,22674,15070,20021,20212,20403,8453},
+        {30791,43159,47415,40582,41586,42088,41797,41753,41972,35074,26530,26680,26026,40631,30104,46279,39731,40735,41237,41913,41663,41883,34871,26267,26417,25763,44644,43591,21187,44387,45533,46275,47246,48259,48351,32768,16742,16655,16329,38197,37404,41962,20021,36960,37340,37893,38337,39373,28886,23548,23698,23166,39128,38335,43017,34867,19903,36703,37059,37465,38501,26646,23809,23959,24076,39604,38811,43708,35226,34628,19448,36112,36518,37554,23822,23976,23930,23874,39334,39446,44611,35743,34964,34069,18998,35547,36612,21496,23342,24089,23837,39290,39214,45553,36153,35339,34445,33527,18381,35647,19553,22510,23257,23797,39500,39424,45643,37124,36310,35416,34526,33615,18127,18226,21740,22488,23028,33171,32990,31130,27389,25297,22665,20489,18666,17423,4474,16010,15889,15485,25134,24902,16044,22414,22646,22801,22200,21417,20700,15482,7977,20538,20957,25263,25030,15941,22542,22774,22748,22895,22111,21395,15350,19603,8171,21174,24644,24411,15621,22041,22882,22695,22661,22625,21908,14966,19998,20189,8167},
+        {30665,43233,47850,40657,41430,42219,41731,41649,41876,42098,35074,26454,25800,40699,29956,46711,39805,40579,41368,41846,41560,41786,42008,34871,26191,25537,45062,44006,21012,44797,45685,46714,47460,48435,48544,48793,32768,16401,16075,38265,37472,42355,19826,36804,37471,37827,38233,39276,39268,28886,23471,22939,38985,38192,43173,34725,19653,36615,36971,37377,38420,39260,26500,23671,23789,39719,38926,44122,35341,34540,19557,36353,36561,37567,38407,24253,23910,23853,39267,39380,44818,35677,34876,34296,19095,35590,36624,37464,21744,24040,23787,39189,39113,45725,36052,35251,34489,33572,18469,35658,36498,19685,23208,23748,39406,39330,45831,37030,36229,35433,34543,33630,18210,35575,18321,22434,22975,39608,39532,46060,37022,37005,36209,35319,34406,33541,18152,17527,22495,23036,33170,32990,31130,27388,25163,23061,20716,18786,17507,16756,4273,15776,15372,25053,24820,15707,22332,22509,22720,22841,22058,21337,21392,15246,7885,20943,24434,24201,15387,21831,22617,22667,22607,22571,21851,21906,14862,19975,7880},
+        {30537,43261,48195,40684,41458,42017,41816,41537,41726,41948,42174,35074,25570,40724,29806,47054,39833,40606,41166,41932,41447,41636,41858,42085,34871,25307,45396,44337,20835,45117,46005,46776,47809,48559,48631,48880,49134,32768,15817,38290,37497,42665,19628,36831,37268,37912,38120,39126,39118,39344,28886,22709,39010,38217,43483,34750,19439,36412,37056,37264,38270,39110,39106,26500,23558,39533,38740,44194,35155,34354,19291,36218,36426,37432,38272,39117,24108,23561,39339,39452,45147,35749,34947,34164,19191,35784,36583,37424,38268,22119,23763,39080,39004,45847,35942,35141,34358,33755,18556,35617,36457,37301,19890,23695,39262,39186,45919,36886,36085,35302,34511,33597,18291,35532,36376,18439,22922,39464,39388,46148,36878,36861,36078,35287,34373,33507,18230,36603,17621,22983,39671,39595,46380,37084,36857,36858,36067,35153,34287,34494,18215,17000,23044,33170,32989,31130,27388,25163,22927,21061,18973,17613,16840,16247,4098,15259,24220,23987,15148,21617,22403,22398,22576,22514,21794,21848,21903,14757,7593},
+        {30939,44229,49621,41515,42139,42723,42292,42300,42254,42476,42702,42932,34990,41654,30186,48486,40664,41292,41876,42411,42215,42168,42391,42617,42847,34792,46760,45708,21677,46534,46333,47336,48111,49149,48957,49206,49460,49718,32768,39088,38296,44019,19759,37517,38100,38514,39010,39780,39772,39999,40229,28963,39667,38879,43800,35411,20143,36609,37023,37519,38289,39129,39126,39356,27555,40214,39425,44733,35957,34542,20037,36376,36872,37642,38483,39327,39327,25008,39808,39925,45449,36340,34925,34326,19887,36010,36809,37649,38494,39342,22874,39807,39735,46406,36791,35376,34778,33971,19617,35936,36776,37621,38469,21091,39773,39701,46236,37519,36104,35506,34727,33912,19345,35851,36696,37544,19520,39976,39904,46465,37511,36880,36282,35503,34688,33822,19282,36922,37770,18625,40182,40110,46697,37718,36876,37062,36283,35468,34602,34809,19267,38001,17994,40393,40321,46934,37928,37087,37062,37067,36252,35386,35593,35804,19300,17642,33115,32940,31130,27489,26137,23768,21768,20091,18620,17774,17172,16828,5023},
+        {25124,40469,40392,34415,26748,25586,24070,23093,22218,21902,21508,21198,19844,38321,22240,34075,32220,29553,28722,28521,27895,27495,27568,27500,27475,26677,38254,32618,21654,31558,28746,27916,27715,27862,27265,27338,27270,27245,26447,32768,30636,30030,10169,25390,23519,23145,22157,21469,20994,20576,20242,18878,25673,27713,26956,24407,11767,24948,24890,24947,25038,25222,25095,25070,25079,24553,26933,26176,22635,23372,12333,24579,24711,24820,25040,25231,25147,24978,23131,26744,25987,22269,23319,23010,12421,24551,24704,24935,25128,25361,25134,22197,26146,26124,21326,23367,23129,22980,12481,24340,24784,24980,25217,25306,21360,25762,25555,20662,23443,23220,23114,22765,12355,24325,24560,24800,24926,21046,25829,25623,20201,23619,23431,23334,23187,22750,12601,24829,25069,25195,20666,25762,25556,19797,23499,23607,23512,23368,22967,23221,12597,25127,25253,20365,25737,25530,19472,23473,23527,23728,23587,23189,23443,23496,12600,25311,19132,24982,24776,18230,23507,23386,23533,23687,23324,23578,23631,23685,11667},
+        {32916,40942,38086,36736,33411,32447,31360,30943,30544,30617,30549,30524,29864,38778,25653,40282,34409,26789,25626,25016,23928,23053,22736,22343,22033,20679,36497,38182,22159,32234,29563,28738,28479,28655,28058,28131,28063,28038,27239,34899,32768,30683,11292,25858,24735,23219,23205,22519,22047,21631,21300,19930,31443,25743,27750,24869,12121,25797,25654,25857,25949,26132,26006,25980,26010,30534,24623,26975,23787,24197,12853,25344,25642,25751,25971,26162,26078,25909,29483,24006,26731,22336,24063,23754,13432,25188,25341,25753,25946,26180,25953,29089,22976,26896,22298,24253,24035,23589,13559,25201,25644,25841,26077,26167,28705,22140,26327,21636,24329,24127,23723,23593,13433,25185,25420,25660,25787,28772,21826,26395,21178,24506,24338,24116,24015,23578,13679,25689,25929,26056,28706,21445,26328,20776,24385,24513,24293,24196,23795,24048,13675,25987,26114,28680,21144,26302,20454,24360,24434,24509,24415,24017,24271,24324,13678,26172,28060,19912,25548,19206,24413,24292,24314,24515,24152,24406,24459,24513,12745},
+        {33650,40977,41386,37384,34338,33376,32289,31558,31362,31435,31367,31342,30682,39294,32898,41006,36646,33414,32453,32061,31163,30967,31040,30972,30947,30287,39193,38865,26213,34405,26833,25673,25063,24668,23890,23573,23180,22870,21516,35505,34852,32768,12409,26194,25201,24433,23276,23565,23096,22683,22355,20981,32348,31474,25816,25212,12448,26498,26479,26457,26855,27039,26912,26887,26917,31441,30567,24698,24248,24879,13207,26189,26242,26657,26877,27068,26985,26815,30390,30194,24080,23487,24864,24575,13953,25787,26268,26680,26873,27107,26879,29679,29322,23662,22363,24837,24619,24173,14353,25234,26277,26474,26710,26800,29493,29136,22920,22606,25212,25010,24626,23620,14511,26041,26276,26517,26643,29561,29204,22606,22151,25389,25221,25018,24621,24402,14757,26545,26786,26912,29494,29137,22225,21752,25268,25396,25196,24802,24619,24873,14753,26844,26970,29468,29111,21924,21432,25243,25316,25412,25021,24841,25095,25148,14757,27028,28848,28491,20692,20182,25296,25175,25217,25121,24976,25230,25283,25337,13824},
+        {53459,57606,57507,58695,46918,46917,46380,45977,45539,45770,45965,46163,46032,54816,53426,57157,57477,46384,46382,46383,45849,45410,45641,45837,46034,45903,54726,54399,53396,56265,45851,45849,45850,45853,45283,45514,45709,45907,45776,55366,54243,53126,32768,41786,42478,43172,43863,44504,44585,44779,44975,44153,44545,44041,43537,39488,12216,34829,35078,35302,35309,36391,36345,36531,36926,44547,44043,43539,40119,33154,12295,34236,34462,34472,35557,36297,36253,36488,44042,44048,43544,40751,33397,32613,12425,33620,33632,34720,35463,36205,36210,43662,43545,43551,41381,33615,32835,32051,12559,32762,33881,34627,35372,36163,43249,43132,43015,41967,33628,32850,32069,31258,12481,32747,33496,34243,35037,43461,43345,43228,42038,34632,33856,33078,32297,31244,12752,33792,34539,35333,43640,43523,43406,42213,34588,34538,33762,32984,31934,32207,12767,34769,35563,43820,43703,43587,42391,34757,34496,34446,33670,32623,32896,33107,12790,35793,43692,43576,43459,41638,35128,34717,34456,34406,33361,33635,33845,34056,12525},
+        {32556,41516,41721,42615,37874,31658,30559,29972,29427,29440,29596,29568,29062,39189,31693,40964,42084,37533,30699,30273,29526,28980,28993,29149,29121,28463,39399,38693,30880,41699,36894,29741,29315,29278,28563,28575,28731,28704,28018,40145,39677,39341,23749,32768,22365,21718,21514,21413,20912,20760,20439,20111,35805,35512,34945,31132,9030,21624,21102,20711,19792,20449,20136,19799,19454,30030,29132,28234,21449,20894,9591,23259,23563,23742,24369,24637,24548,24530,28969,28741,27842,20797,20357,22234,10456,23306,23534,24172,24480,24720,24641,28391,28004,27808,20553,19942,22525,22256,11296,23080,23774,24283,24525,24776,27850,27464,27102,20408,19038,22688,22464,22012,11761,22606,23807,24053,24306,27860,27473,27112,19925,19629,23271,23057,22657,21539,11958,24029,24276,24529,28002,27616,27254,19768,19322,23524,23347,23133,22661,22867,12242,24567,24820,27974,27587,27226,19457,18995,23440,23566,23354,22886,23092,23361,12246,24881,27505,26979,26592,19139,18660,23422,23492,23583,23117,23323,23592,23647,12250},
+        {32570,42407,42478,44654,41677,37964,30131,29575,29227,29240,29109,29311,28479,39981,31508,41593,43316,40797,37615,29665,28976,28628,28641,28509,28712,27880,40068,39239,30650,42788,39929,36971,28707,28691,28183,28195,28064,28267,27435,42016,40800,40334,23057,43170,32768,20726,20542,20671,20170,19731,19668,19109,39311,38489,37676,40844,19795,26458,24880,25008,25348,25973,25636,25839,25779,35864,35565,34992,31132,25220,7909,19938,19664,18787,19454,19227,19003,18393,28554,28160,27261,19881,23714,19275,9404,22212,22594,23234,23609,23924,23628,28003,27476,27248,19655,23839,18968,21238,10282,22338,23033,23413,23767,23800,27645,27118,26732,19721,24158,18104,21596,21326,10982,22516,22937,23492,23528,27655,27128,26742,19239,24738,18705,22190,21973,21462,11179,23160,23715,23751,27523,26996,26609,18809,24417,18474,22528,22315,21842,22048,11093,23697,23733,27709,27182,26795,18737,24603,18251,22825,22648,22362,22568,22542,11385,24024,26933,26406,26020,18209,24555,17679,22560,22686,22402,22609,22583,22852,11189},
+        {31777,42628,42698,45038,41936,42670,37749,28548,28230,28243,28309,28224,27623,40153,31500,42051,44964,41088,41822,37700,28544,28227,28240,28306,28221,27619,40238,39634,30445,43629,40214,40948,37051,28079,27629,27642,27708,27623,27021,42390,42316,41102,22363,43817,44809,32768,19550,19699,19198,18984,18635,18333,39518,38728,37910,41434,19777,36822,26381,24270,24630,25259,25130,25045,25215,40208,39418,38600,42356,34775,19365,23730,23677,24037,24666,25335,25045,25041,35666,35619,35041,31132,25118,22646,6810,18540,17756,18449,18232,18094,17597,27057,27057,26663,18738,23132,22569,17923,9230,21232,21915,22470,22892,23000,26727,26726,26200,18823,23472,22909,17146,20297,9967,21596,22191,22618,22765,26737,26736,26210,18340,24056,23493,17771,20934,20606,10165,22414,22841,22988,26788,26787,26260,18119,23925,24113,17549,21444,21154,21360,10314,22823,23168,26699,26698,26172,17774,23836,23836,17402,21825,21539,21746,21720,10236,23150,26137,26137,25610,17484,24002,23841,16934,21941,21691,21898,22055,22029,10328},
+        {31328,42901,42866,46086,41779,42520,42260,37263,27458,27464,27567,27680,26791,40402,30685,41892,44956,40928,41669,42403,37174,27195,27201,27304,27417,26527,40367,39456,30419,44885,40113,40826,41560,37128,27193,27198,27302,27415,26525,43378,42330,42259,21672,44021,44993,45985,32768,18702,18185,18009,17884,17295,39342,38549,37789,41616,19757,36836,37448,26301,23892,24514,24422,24534,24417,40038,39245,38459,42519,34766,19332,36503,23647,23295,23916,24617,24535,24243,39795,39935,39149,43441,35338,34446,18941,21492,22702,23324,24024,24740,24243,35209,35133,35088,31132,25014,22539,20521,5735,16654,17435,17227,17099,16688,26009,25777,25776,17902,22765,22198,21636,16119,8915,20450,21070,21671,21886,26012,25780,25779,17404,23342,22776,22213,16828,19539,9113,21293,21894,22109,26097,25865,25864,17216,23246,23427,22864,16615,20111,20317,9299,22074,22289,26191,25959,25958,17079,23340,23339,23528,16477,20664,20871,21028,9456,22272,25355,25123,25122,16517,23231,23070,23069,16086,20865,21071,21228,21202,9179},
+        {30918,43012,42902,46811,41415,42124,41871,41847,36776,26688,26784,26934,26280,40495,30253,41929,45678,40564,41272,42014,41758,36687,26424,26521,26671,26017,40397,39487,29623,44550,39718,40426,41168,41906,36503,26162,26259,26409,25755,44066,43016,41970,21031,44122,44864,45836,46833,32768,17185,16992,16905,16579,38974,38182,37393,41700,19773,36633,37224,37841,26224,23771,23700,23850,23967,39641,38848,38059,42391,34557,19333,36278,36894,23562,23174,23867,23822,23765,39404,39544,38756,43295,35110,34216,18932,35954,21401,22577,23271,24018,23766,39382,39306,39450,44221,35686,34792,33904,18567,19513,21984,22678,23425,23962,34752,34676,34512,31132,24912,22430,20407,18636,4704,16301,16198,16079,15679,25292,25059,24827,16480,22632,22066,21499,20937,15773,8079,19954,20579,20997,25370,25138,24905,16277,22555,22710,22144,21581,15659,19074,8266,20796,21215,25498,25266,25034,16174,22683,22657,22838,22276,15530,19651,19842,8461,21432,24879,24647,24415,15854,22791,22605,22604,22785,15148,20047,20238,20429,8456},
+        {31024,43222,43113,47303,41826,42328,42038,42022,41974,36922,26792,26942,26288,40691,30337,42140,46167,40975,41477,42181,41932,41885,36833,26529,26679,26025,40594,39683,29688,45036,40129,40631,41335,42053,41800,36649,26267,26417,25763,44541,43488,42439,20950,44623,45365,46337,47350,48350,32768,16854,16768,16441,39357,38564,37775,42178,20029,37119,37504,38062,38502,26811,23888,24038,24156,39833,39040,38251,42869,35020,19575,36557,37115,37555,23910,24055,24010,23953,39562,39702,38914,43773,35383,34488,19162,36173,36613,21610,23458,24206,23953,39546,39470,39587,44714,35904,35010,34120,18752,35649,19895,22824,23571,24112,39502,39426,39354,45646,36312,35418,34528,33617,18129,18284,21767,22514,23055,34886,34810,34646,31132,25460,22757,20605,18992,17479,4762,16343,16225,15824,25378,25145,24913,16151,22729,22884,22317,21717,20726,15793,8265,20796,21214,25506,25274,25041,16048,22857,22831,23012,22411,21420,15664,19842,8460,21431,24887,24654,24422,15728,22965,22778,22778,22925,21933,15282,20238,20429,8455},
+        {30898,43297,43187,47738,41670,42460,41972,41918,41878,42161,36922,26716,26062,40760,30189,42214,46599,40819,41609,42115,41829,41788,42072,36833,26453,25798,40662,39752,29521,45465,39973,40763,41269,41949,41704,41987,36649,26191,25536,44959,43904,42852,20756,44775,45804,46551,47526,48543,48681,32768,16514,16188,39214,38421,37633,42335,19779,37032,37416,37974,38421,39521,26666,23751,23868,39948,39155,38367,43284,34932,19684,36797,37158,37568,38668,24342,23989,23932,39496,39636,38847,43979,35295,34715,19259,36216,36626,37726,21858,24156,23904,39446,39370,39487,44887,35816,35055,34165,18841,35660,36788,20027,23522,24063,39408,39332,39260,45834,36231,35435,34545,33632,18211,35577,18378,22461,23002,39669,39593,39521,45958,37254,36459,35569,34683,33543,18413,17845,22753,23293,34886,34810,34646,31132,25326,23153,20832,19112,17563,17054,4560,16112,15711,25296,25064,24831,15813,22592,22803,22958,22358,21363,21632,15560,8173,21201,24677,24444,24212,15493,22700,22750,22724,22871,21876,22145,15178,20215,8169},
+        {30770,43325,43215,48083,41698,42257,42057,41806,41728,42011,42237,36922,25831,40785,30039,42242,46941,40847,41406,42200,41716,41638,41922,42148,36833,25568,40687,39777,29351,45805,40001,40560,41354,41836,41554,41837,42064,36649,25306,45293,44235,43180,20560,45096,45867,46900,47651,48630,48767,49021,32768,15930,39239,38446,37658,42644,19565,36829,37501,37861,38271,39371,39367,26666,23638,39762,38969,38181,43356,34746,19418,36663,37024,37434,38534,39378,24196,23641,39568,39708,38919,44309,35366,34583,19354,36410,36585,37685,38529,22233,23879,39336,39260,39377,45009,35706,34924,34348,18927,35618,36747,37591,20233,24009,39264,39188,39116,45922,36087,35304,34513,33599,18292,35534,36378,18496,22948,39525,39449,39377,46046,37110,36327,35536,34650,33509,18491,36666,17939,23240,39732,39655,39584,46279,37106,37107,36316,35430,34289,34554,18476,17321,23301,34885,34809,34645,31132,25326,23019,21176,19299,17669,17137,16548,4385,15598,24463,24231,23998,15255,22486,22481,22693,22814,21819,22088,22143,15074,7882},
+        {31172,44292,44183,49509,42380,42963,42532,42569,42256,42539,42765,42996,36832,41715,30418,43210,48374,41533,42116,42679,42483,42170,42454,42680,42910,36751,41617,40707,29712,47241,40687,41270,41833,42604,42086,42369,42596,42826,36572,46657,45605,44554,21382,45424,46426,47202,48240,48956,49094,49347,49605,32768,39896,39107,38319,42961,20270,37026,37468,38116,38291,39391,39387,39617,27721,40442,39654,38865,43894,34934,20164,36821,37469,37644,38744,39588,39588,25096,40037,40181,39392,44610,35344,34745,20051,36636,36811,37911,38755,39603,22988,40063,39991,40108,45568,35942,35343,34564,19988,35938,37066,37910,38759,21434,39775,39703,39631,46238,36106,35508,34729,33914,19347,35853,36697,37546,19578,40036,39964,39892,46363,37130,36531,35752,34965,33824,19543,36985,37833,18943,40243,40171,40099,46596,37125,37311,36532,35745,34604,34869,19528,38064,18315,40454,40382,40310,46833,37336,37311,37317,36529,35388,35653,35864,19561,17966,34825,34757,34598,31132,26300,23860,21884,20417,18676,18072,17473,17131,5310},
+        {24452,42342,42242,42162,34415,24562,23030,22087,21421,20846,20690,20380,20064,40019,22174,35761,35664,32171,27839,27632,27040,26822,26637,26780,26755,26125,39932,34178,21568,34707,31502,27029,26822,26998,26592,26407,26550,26525,25868,39862,34092,33187,20990,29730,26224,26017,26193,26561,26178,26321,26296,25639,32768,30556,29943,28309,8816,22134,21907,20974,20296,19908,19593,19259,18918,23614,26078,25317,24560,21360,11062,23302,23436,23707,24013,24266,24183,24168,22177,25883,25122,24365,21130,21797,11150,23276,23591,23907,24163,24397,24324,21274,25316,25287,24531,20239,21919,21770,11245,23409,23756,24050,24286,24530,20628,25103,24897,24875,19584,22169,22062,21885,11336,23332,23845,24085,24332,20071,24920,24713,24507,19199,22446,22349,22201,21796,11242,23836,24076,24322,19908,25053,24847,24640,18889,22688,22594,22482,22284,22267,11503,24345,24591,19607,25027,24821,24615,18565,22609,22810,22700,22506,22489,22742,11507,24649,19299,24437,24206,23999,18232,22593,22740,22926,22735,22717,22971,23024,11510},
+        {32628,42984,39616,39522,36856,31703,30670,30254,30036,29851,29994,29969,29485,40629,24950,42130,42054,34409,24602,24010,22922,22256,21681,21525,21215,20898,37905,39858,22073,35605,32182,27851,27612,27791,27385,27200,27343,27318,26656,37822,39792,34061,21494,30023,27046,26807,26986,27353,26971,27114,27089,26428,34979,32768,30600,28610,9941,23349,21981,22022,21347,20961,20649,20318,19979,29813,23685,26116,25359,22512,11583,24092,24367,24638,24944,25197,25114,25099,28813,23083,25891,25134,21196,22567,12196,24094,24410,24726,25016,25250,25176,28419,22054,26059,25303,21211,22826,22551,12323,24269,24617,24910,25147,25391,28206,21408,25669,25647,20558,23075,22843,22713,12414,24192,24705,24946,25192,28022,20851,25485,25279,20175,23352,23130,23029,22624,12320,24696,24936,25183,28156,20688,25619,25412,19869,23595,23407,23310,23112,23095,12581,25205,25452,28130,20387,25593,25387,19547,23515,23623,23528,23334,23317,23570,12585,25510,27677,20078,24974,24767,19217,23499,23553,23754,23563,23545,23799,23852,12588},
+        {33359,42126,43152,40297,37512,32632,31599,31050,30854,30669,30812,30787,30299,40340,32562,42623,39456,36769,31708,31335,30628,30432,30247,30390,30365,29731,40792,40330,25484,41946,34405,24645,24053,23871,23093,22518,22362,22052,21735,38579,37785,39719,21998,30590,27859,27625,27746,28142,27760,27902,27877,27216,35592,34935,32768,29164,11063,23816,23194,22094,22393,22010,21701,21372,21036,30720,29846,23755,26149,22972,11937,24937,25127,25544,25850,26103,26020,26005,29719,29492,23154,25929,22347,23387,12716,24854,25336,25652,25942,26176,26103,29181,28798,22929,26043,21276,23566,23291,13334,24902,25250,25725,25961,26205,28994,28612,22187,26415,21528,23958,23746,23319,13492,25049,25562,25802,26048,28811,28428,21630,26047,21148,24235,24032,23635,23448,13398,25553,25793,26039,28944,28562,21468,26180,20845,24477,24309,24087,23936,23919,13659,26062,26308,28919,28536,21167,26155,20525,24398,24525,24306,24158,24141,24394,13663,26366,28461,27942,20858,25535,20198,24382,24456,24532,24387,24369,24623,24676,13666},
+        {34092,42648,42828,43509,39271,33555,32524,31975,31464,31483,31625,31600,31113,40843,33295,42099,42979,38916,32631,32260,31553,31043,31061,31204,31178,30544,41030,40345,32546,42583,38288,31709,31338,31326,30649,30668,30810,30785,30124,41128,40666,40323,26047,34403,24691,24101,23919,23835,23357,23200,22891,22574,37226,36925,36371,32768,12181,24135,23660,23306,22463,23055,22748,22423,22089,31620,30747,29873,23828,23300,12264,25635,25948,26140,26752,27006,26922,26907,30622,30395,29521,23228,22806,24065,13070,25695,25932,26555,26845,27079,27005,30083,29701,29506,23004,22426,24363,24108,13855,25498,26172,26647,26884,27128,29580,29198,28841,22873,21593,24538,24325,23898,14286,25077,26190,26431,26677,29595,29213,28856,22410,22118,25114,24911,24533,23472,14476,26405,26645,26891,29729,29346,28989,22248,21816,25356,25188,24986,24538,24739,14737,26914,27160,29703,29321,28964,21946,21500,25277,25404,25204,24760,24961,25215,14741,27218,29246,28727,28344,21638,21175,25261,25335,25430,24989,25190,25443,25497,14745},
+        {53448,56711,56574,56475,60156,47340,46857,46471,46050,45926,46176,46390,45929,53983,53378,56196,56098,58934,46806,46823,46305,45884,45760,46010,46224,45556,53858,53504,53348,55749,57717,46273,46290,46310,45757,45632,45882,46096,45392,53768,53414,53087,53319,56505,45740,45758,45778,45762,45506,45756,45970,45265,56719,55594,54472,53354,32768,41970,42681,43394,44067,45021,45120,45333,45547,44954,44450,43946,43442,39663,12031,34981,35246,35448,35739,36837,36807,37008,44499,44471,43966,43462,40311,33297,12160,34404,34609,34902,36003,36759,36731,44134,43983,43989,43485,40961,33555,32772,12332,33767,34063,35167,35925,36683,43737,43586,43470,43475,41575,33755,32974,32190,12499,32930,34065,34826,35587,43614,43463,43346,43229,42447,34027,33249,32468,31415,12473,33989,34750,35511,43844,43693,43576,43459,42536,35046,34270,33492,32470,32391,12762,35046,35807,44040,43889,43772,43655,42729,35017,34967,34191,33171,33093,33367,12784,36037,43614,43274,43123,43006,42924,35201,34940,34890,33873,33795,34068,34279,12807},
+        {33460,42983,42820,43000,46143,40505,31123,30569,30221,29905,29993,30196,30179,40530,32370,41913,42093,44805,39981,30628,29941,29594,29278,29366,29569,29399,40401,39551,31512,41341,44277,39618,29670,29657,29148,28832,28920,29123,28926,40587,39738,39037,30706,43911,39077,28713,28699,28902,28416,28503,28706,28509,43401,42186,41719,41400,23565,32768,20674,20492,20621,20840,20509,20447,20119,38225,37765,37451,36973,31133,8816,20008,19911,19840,19244,20073,19852,19511,29502,29082,28184,27286,19865,19379,9445,22705,23215,23616,24318,24632,24554,28953,28401,28172,27274,19641,19235,21721,10351,22980,23415,24121,24476,24726,28596,28043,27657,27461,19707,19118,22202,21953,11225,22898,23667,24223,24476,28267,27714,27327,26966,19860,18514,22570,22352,21842,11724,22932,24138,24391,28346,27794,27407,27046,19538,19269,23222,23009,22557,21838,11938,24361,24614,28532,27979,27593,27232,19466,19049,23519,23342,23077,22964,23170,12229,24905,28514,27822,27409,27048,19147,18717,23446,23571,23308,23196,23402,23671,12234},
+        {32636,43050,42885,43098,46368,43240,40124,29513,29196,29077,29165,29080,29142,40559,32360,42238,42278,46295,42392,40072,29510,29192,29074,29162,29077,29138,40428,39824,31305,41397,44960,41518,39700,29045,28594,28476,28564,28479,28512,40645,39881,39056,30457,44433,40655,39154,28087,28311,28031,28119,28034,28067,43628,43554,42341,41875,22854,44861,32768,19495,19645,20093,19763,19413,19344,40763,39974,39155,38346,42429,19619,23913,24286,24652,25222,25922,25632,25845,37874,37825,37504,37020,31133,22855,7722,18787,18810,18238,19079,18943,18715,27982,27981,27587,26689,18720,23164,18189,9299,21874,22471,23179,23601,23926,27652,27651,27125,26896,18805,23509,18159,20924,10210,22152,22922,23348,23713,27505,27505,26978,26591,19169,24040,17580,21480,21152,10944,22837,23264,23826,27585,27584,27058,26671,18848,24689,18344,22138,21869,21756,11159,23487,24049,27496,27496,26969,26582,18502,24412,18200,22519,22254,22142,22348,11080,24031,27553,27552,27000,26613,18423,24608,17972,22826,22598,22668,22874,22848,11372},
+        {32185,43063,43027,43065,47358,43090,42871,39948,28424,28336,28424,28536,28310,40568,31542,42054,42092,46228,42239,42977,39834,28161,28072,28161,28273,28019,40533,39623,31276,41450,46157,41396,42135,39785,28158,28070,28158,28271,28016,40588,39678,39078,30233,44824,40527,41265,39234,27694,27473,27561,27674,27419,44561,43513,43441,42229,22141,45043,46040,32768,18649,19117,18787,18663,18306,40593,39801,39015,38201,42591,19586,37417,23836,23910,24500,25204,25121,25047,40389,40495,39709,38895,43517,35324,19195,21549,23317,23907,24611,25326,25047,37705,37606,37558,37070,31133,22753,20613,6650,17708,17224,18073,17949,17806,26934,26702,26701,26307,17884,22798,22236,17133,9158,21034,21800,22401,22834,26815,26583,26582,26055,18267,23349,22787,16637,20113,9930,21913,22514,22947,26895,26662,26662,26135,17945,24003,23440,17410,20826,20896,10144,22737,23170,26989,26757,26756,26229,17808,23916,24104,17275,21379,21449,21656,10301,23153,26771,26512,26512,25985,17456,23837,23837,17124,21771,21841,22047,22021,10223},
+        {31771,43171,43024,42994,48073,42694,42482,42459,39560,27559,27640,27790,27799,40659,31106,42051,42020,46940,41843,42588,42332,39446,27296,27377,27527,27508,40527,39617,30477,41052,45812,40997,41742,42481,39357,27034,27115,27265,27246,40497,39586,38680,30226,45743,40187,40905,41643,39311,27033,27114,27264,27244,45239,44188,43142,43072,21468,44914,45890,46886,32768,18117,17769,17682,17588,40196,39404,38615,37859,42463,19587,37192,37808,23757,23757,24454,24409,24569,39998,40104,39315,38534,43370,35094,19186,36868,21467,23160,23857,24605,24570,39976,39865,40009,39228,44296,35671,34783,18821,19760,22568,23265,24012,24766,37339,37239,37163,37117,31133,22649,20506,18902,5620,16091,17045,16929,16798,26094,25862,25630,25629,17343,22640,22073,21510,15582,8896,20611,21237,21872,26167,25935,25703,25702,17006,23287,22720,22158,16455,19687,9111,21460,22095,26296,26063,25831,25830,16903,23234,23415,22852,16328,20264,20470,9305,22313,26294,26036,25804,25803,16792,23372,23372,23553,16186,20851,21057,21248,9500},
+        {31091,43053,42906,42801,48479,42101,41857,41841,41822,39092,26800,26950,26959,40538,30404,41933,41828,47343,41249,41963,41714,41695,38977,26537,26687,26668,40406,39496,29755,40860,46212,40403,41117,41862,41611,38889,26275,26425,26406,40313,39403,38496,29144,45086,39562,40276,41021,41764,38724,26014,26164,26144,45627,44574,43525,42480,20514,44695,45442,46418,47418,32768,16724,16637,16543,39615,38822,38034,37249,42247,19291,36760,37355,37976,23679,23647,23630,23791,39387,39493,38704,37920,42942,34671,18879,36413,37034,21382,23051,23798,23763,39371,39261,39405,38620,43850,35229,34339,18506,36098,19669,22454,23201,23959,39354,39244,39172,39320,44781,35810,34920,34036,18127,18062,21632,22379,23137,36898,36798,36722,36574,31133,22546,20397,18787,17277,4458,16136,16020,15888,25378,25145,24913,24681,16031,22508,21941,21375,20601,15605,7962,20568,21204,25506,25273,25041,24809,15928,22480,22636,22069,21295,15479,19632,8156,21421,25505,25247,25014,24782,15817,22619,22593,22774,22000,15337,20219,20410,8351},
+        {31196,43188,43041,42936,48800,42437,41986,41933,41921,41937,39237,26954,26963,40665,30486,42068,41963,47662,41586,42092,41806,41794,41811,39123,26691,26671,40533,39622,29818,40995,46528,40740,41246,41954,41710,41726,39035,26429,26409,40440,39529,38623,29190,45399,39899,40405,41113,41835,41647,38869,26168,26148,45942,44886,43834,42787,20415,45026,45772,46748,47766,48811,32768,16495,16401,39927,39135,38346,37561,42565,19532,37171,37560,38122,38626,24211,23814,23975,39509,39615,38826,38042,43260,35064,19107,36617,37179,37684,21669,23981,23947,39459,39349,39493,38708,44168,35431,34541,18727,36241,36746,19864,23385,24143,39449,39338,39266,39388,45115,35959,35069,34183,18305,35535,18443,22521,23279,39455,39345,39273,39205,46080,36418,35528,34642,33503,18136,17626,22525,23283,37032,36933,36856,36708,31133,23043,20668,18972,17633,16854,4542,16165,16033,25509,25277,25045,24813,15797,22650,22805,22239,21427,21421,15614,8156,21421,25508,25250,25018,24786,15687,22789,22763,22944,22131,22126,15472,20410,8351},
+        {31068,43216,43069,42964,49145,42234,42071,41820,41771,41787,42075,39237,26732,40690,30336,42096,41991,48004,41383,42177,41693,41644,41661,41948,39123,26441,40558,39648,29649,41023,46868,40537,41331,41842,41560,41576,41864,39035,26179,40465,39555,38648,29004,45736,39696,40490,41001,41685,41497,41784,38869,25918,46276,45217,44163,43112,20202,45088,46122,46872,47853,48898,49040,32768,16144,39741,38949,38160,37375,42637,19266,37037,37425,37987,38492,39596,24065,23683,39581,39687,38898,38114,43590,34933,19203,36811,37139,37643,38747,22044,23922,39349,39239,39383,38599,44290,35300,34725,18813,36200,36704,37809,20070,24089,39305,39194,39122,39244,45203,35827,35036,34150,18386,35492,36624,18561,23226,39312,39201,39129,39061,46168,36287,35496,34610,33468,18214,36624,17720,23230,39577,39467,39395,39327,46297,37314,36523,35637,34523,34514,18458,17362,23521,37032,36932,36856,36708,31133,22909,21013,19159,17740,16937,16589,4367,15920,25294,25036,24804,24572,15449,22520,22731,22886,22074,22069,22338,15367,8064},
+        {30758,43211,43073,42969,49498,42316,41892,41928,41644,41661,41948,42178,38445,40672,29977,42079,41974,48354,41443,42007,41811,41527,41543,41831,42061,38105,40549,39618,29270,41006,47215,40597,41161,41959,41442,41459,41746,41977,37980,40456,39525,38618,28609,46081,39756,40320,41118,41568,41379,41667,41897,37814,46617,45556,44499,43446,19988,45416,46191,47229,47947,48992,49134,49391,32768,39815,39002,38213,37429,42954,19036,36823,37500,37827,38331,39435,39435,24065,39415,39529,38741,37956,43669,34737,18924,36666,36993,37498,38602,39450,21899,39441,39339,39483,38699,44627,35362,34583,18898,36149,36653,37757,38606,20370,39180,39079,39007,39128,45298,35673,34894,34107,18464,35440,36573,37421,18743,39187,39086,39014,38946,46264,36133,35354,34567,33426,18290,36572,37421,17824,39453,39351,39279,39211,46392,37160,36381,35594,34480,34471,18534,37712,17457,39664,39562,39490,39422,46629,37160,37166,36378,35265,35255,35525,18567,17110,36297,35990,35880,35732,31133,22909,20879,19436,17905,17031,16673,16334,4219},
+        {23901,43796,43485,43387,44407,34415,22113,21154,20522,20155,19741,19669,19130,41349,22211,36766,36649,37416,32124,26947,26375,26191,26188,26073,26259,25579,41068,35106,21584,35690,36457,31448,26136,26306,25934,25931,25816,26002,25321,40982,35001,34094,20988,35505,29671,25327,25497,25894,25702,25587,25773,25093,41921,35722,34815,33915,20581,27310,24772,24942,25339,25920,25608,25794,25720,32768,30486,29865,28226,26036,7767,20821,19997,19358,18980,18752,18522,17928,21335,25220,24459,23698,23167,20127,10162,22179,22503,22982,23357,23654,23374,20417,24672,24618,23857,23326,19338,20729,10256,22355,22865,23244,23543,23580,19802,24491,24260,24231,23699,18720,21030,20885,10382,22622,23039,23376,23416,19435,24479,24248,24041,24245,18344,21474,21359,21125,10505,23030,23549,23588,19030,24361,24130,23923,23943,18110,21817,21705,21507,21490,10426,23540,23579,18946,24536,24304,24098,24117,17881,22101,21991,21829,21983,21966,10695,23848,18440,23898,23666,23460,24053,17325,21845,22031,21871,22025,22008,22261,10513},
+        {32642,45205,40488,40374,41279,36958,30276,29853,29670,29666,29551,29737,28939,42669,24364,43373,43279,44298,34409,23093,21989,21357,20990,20576,20504,19965,38704,40993,22088,36588,37355,32133,26926,27099,26727,26724,26609,26795,26110,38602,40912,34968,21492,36403,29970,26117,26290,26687,26495,26380,26566,25881,39457,41850,35689,34788,21085,27770,25561,25734,26131,26713,26400,26586,26533,35049,32768,30527,28534,26491,8892,20894,21044,20409,20033,19808,19580,18989,28426,22241,25228,24467,23936,20193,11208,23032,23356,23834,24210,24506,24226,28026,21197,25390,24629,24098,20309,21542,11335,23216,23725,24104,24404,24441,27845,20582,25032,25003,24471,19694,21843,21713,11460,23482,23900,24237,24276,27833,20215,25020,24813,25017,19321,22287,22187,21953,11583,23891,24409,24449,27715,19809,24902,24695,24715,19090,22630,22533,22335,22318,11504,24400,24440,27890,19726,25076,24870,24889,18863,22914,22819,22657,22811,22794,11773,24709,27137,19220,24434,24228,24844,18309,22658,22859,22699,22853,22836,23089,11592},
+        {33370,43134,45287,41149,42058,37620,31205,30683,30487,30484,30369,30555,29753,41267,32381,44010,40302,41211,36873,30768,30115,29919,29916,29801,29987,29184,42750,41598,24872,43168,44192,34405,23135,22972,22194,21827,21413,21341,20802,39359,38560,40837,21996,37301,30543,26935,27076,27476,27284,27168,27354,26670,40218,39419,41780,35662,21589,28084,26380,26520,26920,27501,27189,27375,27322,35670,35008,32768,29094,26811,10017,22108,21116,21455,21082,20859,20635,20046,29333,28944,22312,25262,24731,21344,11728,23818,24283,24761,25137,25433,25153,28820,28301,22103,25395,24863,20374,22307,12380,24030,24540,24919,25252,25289,28634,28115,21362,25771,25240,20665,22746,22490,12538,24338,24756,25093,25132,28621,28102,20995,25581,25785,20294,23190,22964,22777,12661,24747,25265,25305,28504,27985,20589,25464,25483,20065,23533,23310,23159,23142,12582,25256,25296,28678,28159,20506,25638,25657,19841,23816,23628,23481,23635,23618,12851,25565,27922,27403,19999,24996,25613,19290,23560,23668,23523,23677,23660,23913,12670},
+        {34101,43470,43519,45441,42832,39385,32130,31608,31280,31298,31183,31369,30566,41594,33112,42667,44165,41986,39023,31693,31040,30711,30729,30614,30800,29998,41659,40854,32321,43638,41150,38389,30771,30778,30291,30309,30194,30380,29578,42900,41748,41287,25416,44086,34403,23179,23016,23144,22666,22251,22179,21641,40975,40176,39386,41707,22093,28562,27189,27334,27676,28286,27974,28160,28106,37309,37001,36441,32768,27284,11140,22573,22329,21526,22127,21907,21685,21099,30235,29846,28973,22382,25517,21804,12082,24659,25039,25663,26039,26335,26055,29722,29203,28976,22174,25655,21524,23124,12900,24786,25462,25841,26175,26212,29391,28872,28490,22237,25976,20729,23482,23226,13550,24968,25385,25903,25943,29406,28887,28505,21775,26549,21263,24069,23863,23379,13739,25599,26118,26157,29288,28769,28387,21369,26247,21037,24411,24209,23761,23962,13660,26108,26148,29463,28944,28561,21286,26422,20815,24695,24527,24254,24455,24438,13930,26417,28706,28187,27805,20779,26377,20267,24439,24567,24296,24497,24480,24734,13748},
+        {34931,44044,43877,44034,46823,41752,33068,32548,32219,31923,32011,32197,32182,42135,33914,43004,43161,45546,41228,32603,31952,31624,31327,31415,31601,31440,41997,41172,33123,42437,45019,40853,31681,31690,31203,30907,30995,31181,30993,42163,41338,40656,32381,44641,40315,30760,30769,30978,30515,30603,30789,30601,44175,43023,42563,42235,25872,34402,23106,22944,23072,23288,22970,22898,22581,39499,39044,38724,38251,32768,11979,22620,22538,22482,21941,22696,22477,22147,31142,30728,29854,28981,22344,21881,12126,25123,25626,26026,26708,27005,26932,30631,30087,29859,28986,22138,21749,23582,12972,25394,25825,26511,26844,27088,30300,29756,29373,29178,22201,21644,24059,23823,13787,25330,26075,26593,26840,29998,29454,29072,28715,22349,21093,24429,24222,23739,14251,25395,26513,26760,30079,29535,29152,28795,22038,21772,25070,24868,24440,23766,14456,26728,26974,30253,29709,29327,28970,21955,21553,25354,25186,24933,24837,25038,14725,27243,30237,29557,29149,28792,21646,21231,25284,25412,25162,25066,25267,25520,14729},
+        {53652,56370,55999,55863,57220,61286,47514,47142,46734,46625,46516,46782,46036,53669,53336,55448,55312,56668,60064,47235,46769,46361,46251,46143,46409,45663,53326,52806,53268,54935,56292,58843,46702,46736,46196,46087,45978,46244,45498,53202,52682,52328,53240,55944,57626,46170,46203,46202,45960,45851,46117,45371,54473,53952,53598,53271,53504,56719,45916,45949,45948,46244,46003,46269,46499,57768,56643,55518,54395,53556,32768,42139,42866,43557,44540,45510,45625,45596,45117,44865,44361,43857,43608,39821,11914,35114,35355,35837,36141,37253,37005,44766,44425,44397,43892,43643,40485,33421,12085,34513,34998,35305,36419,36958,44382,44041,43890,43896,43646,41116,33658,32874,12290,33893,34202,35319,35861,44272,43931,43780,43663,43924,42014,34115,33334,32309,12510,34127,35272,35814,44163,43822,43671,43555,43692,42900,34400,33621,32599,32521,12501,35196,35738,44408,44067,43916,43800,43937,43004,35431,34655,33635,33585,33507,12797,36034,43712,43371,43220,43103,44148,42977,35204,35153,34136,34086,34008,34282,12792},
+        {33508,44216,43401,43416,44773,47533,42733,30486,30171,30053,29812,29947,29789,41651,33230,42754,42596,43925,47459,42678,30482,30167,30049,29809,29943,29785,40920,40316,32147,41695,43024,46124,42155,29989,29541,29423,29182,29317,29159,40956,40191,39346,31299,42276,45597,41805,29032,29257,28978,28738,28872,28714,42233,41443,40598,39900,30554,45527,41622,28118,28343,28775,28364,28498,28712,44714,44641,43427,42962,42915,23396,32768,19462,19614,20062,20451,20210,20108,40304,40251,39790,39489,39338,31134,8647,18858,19074,19309,18885,19807,19549,28914,28913,28493,27595,26735,18721,18294,9359,22381,23106,23575,24324,24588,28586,28585,28033,27804,26944,18807,18441,21419,10298,22808,23318,24071,24375,28439,28439,27886,27499,27342,19172,18609,22099,21792,11206,23234,24008,24510,28180,28179,27627,27240,26917,19486,18169,22530,22261,22149,11722,23273,24425,28303,28302,27750,27363,27040,19248,19011,23226,22961,22869,22150,11944,24648,28156,28155,27603,27216,27236,19139,18757,23478,23249,23340,23228,23434,12226},
+        {33054,43497,43462,43302,44657,48406,43700,42639,29399,29311,29268,29403,28957,40985,32382,42467,42307,43662,47275,43570,42297,29107,29019,28976,29111,28666,40950,40019,32116,41666,42848,47204,42728,42245,29105,29017,28974,29109,28663,40824,39893,39293,31073,41972,45871,41858,41888,28641,28420,28377,28511,28066,42099,41168,40408,39587,30289,45624,41249,41699,27727,28180,27975,28110,28035,45538,44491,44419,43206,42997,22669,46073,32768,18613,19082,19701,19459,19070,41181,41072,40286,39472,38895,43572,19468,21691,23940,24536,25181,25927,25587,40210,39901,39850,39542,39385,31134,20783,7580,17972,18295,17880,18812,18640,27868,27610,27609,27215,26355,17883,22843,17415,9246,21690,22370,23124,23496,27749,27491,27490,26964,26773,18266,23399,17666,20752,10191,22483,23259,23631,27672,27414,27413,26887,26538,18791,24000,17234,21385,21455,10942,23174,23546,27795,27537,27537,27010,26661,18553,24693,18086,22086,22177,22064,11164,23769,27374,27116,27115,26589,26583,18172,24371,17908,22422,22513,22401,22607,11077},
+        {32637,43587,43243,43213,44393,49079,43311,43292,42478,28535,28522,28657,28446,41059,31944,42248,42218,43398,47945,43181,42967,42136,28243,28230,28365,28155,40746,39815,31314,41250,42430,46817,42335,43078,42022,27981,27968,28103,27893,40715,39784,38878,31063,41793,46748,41498,42240,41973,27980,27967,28101,27891,41828,40897,39991,39395,30087,45695,40883,41625,41778,27559,27413,27548,27708,46177,45126,44080,44009,43053,21978,45921,46922,32768,18081,18720,18479,18352,40791,40681,39892,39111,38529,43424,19458,37763,21614,23789,24455,25205,25110,40772,40481,40591,39809,39227,44354,35644,19094,19822,23197,23862,24613,25306,40054,39744,39644,39596,39435,31134,20681,18998,6554,17162,16852,17793,17631,27028,26770,26538,26537,26181,17342,22686,22123,16612,9158,21209,21981,22556,26979,26721,26489,26488,25999,17885,23307,22744,16279,20273,9946,22131,22706,27102,26844,26612,26611,26123,17648,24004,23441,17139,20991,21096,10168,22929,26898,26640,26408,26407,26261,17508,23906,24087,16970,21523,21627,21834,10354},
+        {31955,43467,43122,42980,44092,49474,42685,42673,42654,42169,27682,27816,27606,40936,31239,42127,41985,43097,48338,42556,42348,42329,41827,27390,27525,27314,40622,39691,30590,41017,42129,47207,41710,42460,42208,41713,27128,27263,27052,40495,39564,38658,29978,41166,46081,40869,41619,42361,41625,26867,27001,26791,41522,40591,39685,38783,29796,46291,40313,41035,41778,41856,26909,27043,27204,46555,45502,44453,43408,43594,20995,45473,46453,47454,32768,17674,17433,17306,40179,40070,39281,38497,37973,42996,19151,37308,37929,21534,23648,24399,24303,40168,39876,39986,39201,38652,43908,35200,18779,36993,19740,23051,23802,24499,40150,39859,39753,39901,39351,44839,35781,34897,18400,18327,22229,22980,23677,39760,39451,39351,39274,39481,31134,20577,18891,17560,5392,15943,16884,16722,26189,25931,25699,25466,25504,16910,22528,21961,21187,15430,8797,21240,21815,26312,26054,25822,25590,25627,16673,23225,22658,21884,16290,20257,9019,22038,26108,25850,25618,25385,25766,16533,23127,23308,22534,16122,20789,20995,9205},
+        {31272,43273,42929,42787,43824,49710,42016,41972,41960,42006,41738,26972,26762,40745,30534,41934,41792,42829,48571,41887,41648,41636,41681,41396,26680,26470,40432,39501,29866,40824,41861,47437,41041,41759,41514,41559,41282,26418,26208,40304,39373,38467,29238,40898,46308,40200,40918,41668,41480,41193,26157,25947,41269,40338,39432,38529,28698,45462,39613,40331,41081,41888,41324,25939,26100,46783,45727,44676,43628,42839,20025,45084,45834,46815,47861,32768,16383,16257,39528,39418,38630,37845,37293,42620,18842,36801,37401,38085,21457,23588,23520,39486,39195,39305,38520,37968,43320,34707,18461,36463,37147,19655,22991,23688,39476,39184,39078,39226,38674,44232,35269,34384,18077,35965,18237,22165,22862,39510,39219,39112,39045,39425,45198,35903,35017,33905,18153,17422,22404,23101,39353,39044,38944,38867,38989,31134,20475,18781,17445,16668,4257,15975,15813,25519,25260,25028,24796,24602,15694,22442,21876,21098,21309,15441,7870,21147,25314,25056,24824,24592,24740,15554,22370,22525,21747,21959,15272,20157,8056},
+        {31375,43362,43017,42875,43913,49942,42306,42055,42006,42051,42072,41884,26761,40828,30614,42023,41881,42918,48800,42177,41730,41681,41726,41747,41541,26470,40515,39584,29927,40913,41950,47663,41331,41841,41560,41605,41625,41427,26208,40388,39457,38550,29282,40987,46532,40490,41000,41713,41525,41546,41339,25947,41352,40421,39515,38613,28728,45683,39903,40414,41126,41905,41721,41470,26100,47013,45955,44900,43850,43058,19910,45325,46076,47056,48102,49152,32768,16111,39797,39688,38899,38115,37562,42853,19070,37165,37521,38178,38686,21914,23700,39566,39274,39384,38599,38047,43553,35057,18680,36583,37239,37748,19900,23868,39521,39229,39123,39271,38719,44466,35395,34509,18290,36055,36563,18417,23042,39555,39264,39157,39090,39443,45432,36001,35115,34002,18326,36563,17804,23243,39566,39275,39168,39101,39265,46402,36465,35579,34465,34456,18200,17162,23247,39488,39179,39078,39001,39124,31134,20903,19013,17617,17025,16407,4368,15958,25314,25056,24824,24591,24740,15420,22536,22691,21913,22090,22085,15407,8055},
+        {31197,43548,43204,43062,43931,50560,42310,42347,42063,42108,42128,42420,40984,40998,30415,42209,42067,42936,49416,42181,42022,41738,41783,41804,42095,40641,40684,39753,29708,41099,41968,48277,41335,42134,41616,41661,41682,41974,40527,40557,39626,38720,29047,41005,47142,40494,41292,41770,41582,41603,41894,40439,41367,40436,39530,38628,28527,46024,39690,40488,40966,41744,41560,41852,41470,47607,46546,45489,44436,43388,19939,45427,46465,47183,48229,49278,49424,32768,39808,39698,38910,38125,37366,42964,19049,37081,37437,38093,38601,39710,21881,39834,39543,39652,38868,38109,43921,34973,19023,36592,37249,37757,38865,20313,39574,39282,39176,39324,38565,44592,35312,34524,18627,36064,36572,37681,18711,39608,39316,39210,39142,39289,45558,35918,35131,34017,18660,36572,37709,18020,39619,39327,39221,39153,39111,46528,36382,35594,34481,34471,18534,37712,17369,39888,39597,39491,39423,39380,46661,37413,36626,35512,35530,35525,18826,17283,38657,38347,38247,38170,39123,31134,20873,19394,17886,17222,16595,16497,4360},
+        {24134,45316,45005,44906,45942,46854,34415,21073,20425,20093,19887,19557,19256,42771,22755,38073,37766,38480,38895,32718,26618,26428,26459,26525,26454,25984,42490,36336,22107,36806,37520,37935,32041,26549,26171,26201,26268,26196,25727,42404,36052,35145,21493,36566,36981,29869,25740,26131,25973,26039,25967,25498,43358,36722,35816,34913,21036,36033,27661,25146,25537,26148,26026,25954,26120,44200,37109,36202,35300,34393,20418,25231,24354,24744,25356,26007,25738,25727,32768,31036,30415,28412,26361,24103,7868,19922,19371,19017,18799,18655,18165,20351,24908,24854,24093,23526,22771,19271,10346,22075,22600,23141,23560,23660,19721,24721,24489,24460,23893,23138,18736,20630,10471,22391,22971,23393,23495,19385,24740,24509,24302,24467,23713,18383,21119,20918,10628,23143,23566,23702,19170,24794,24563,24356,24343,24324,18158,21623,21458,21612,10767,23557,23875,18843,24718,24486,24279,24267,24063,18004,22007,21845,21999,21982,10696,23865,18555,24279,24048,23841,24429,24061,17543,22114,21954,22141,22295,22277,10779},
+        {31910,45659,40720,40603,41514,42213,36358,28891,28701,28732,28799,28727,28140,43111,23788,44257,43951,44953,45865,34409,21067,20419,20087,19880,19551,19249,38896,41805,22102,37002,37749,38330,32085,26409,26058,26089,26155,26083,25610,38791,41529,35341,21487,36794,37375,29916,25600,25991,25833,25899,25827,25354,39652,42452,36043,35140,21064,36453,27710,25040,25431,26042,25920,25848,26006,40315,43294,36591,35689,34807,20670,25284,24463,24854,25465,26117,25847,25837,34499,32768,30457,28456,26408,24153,7869,19995,19447,19095,18880,18739,18252,27117,20351,24723,23962,23427,22876,19340,10346,22108,22633,23175,23593,23693,26930,19721,24384,24329,23794,23243,18807,20661,10472,22424,23004,23426,23529,26949,19385,24403,24172,24368,23818,18457,21151,20949,10629,23176,23599,23735,27003,19170,24457,24226,24245,24429,18235,21655,21489,21643,10767,23590,23908,26927,18843,24380,24149,24168,24168,18083,22038,21876,22030,22013,10696,23899,26374,18555,23938,23707,24324,24166,17625,22145,21986,22172,22326,22309,10780},
+        {32635,43364,45731,41377,42292,42991,37021,29721,29519,29550,29616,29544,28953,41457,32372,45659,40584,41472,42171,36975,29717,29514,29545,29611,29540,28948,43183,43117,24262,43841,44846,45759,34405,22050,21256,20924,20717,20388,20086,39548,38804,41455,21991,37693,38274,30494,26386,26779,26621,26688,26616,26143,40413,39644,42381,36014,21569,37351,28031,25826,26220,26831,26709,26637,26794,41076,40307,43223,36562,35681,21174,25745,25249,25643,26254,26905,26636,26625,35120,35078,32768,29021,26735,24609,8994,20067,20493,20144,19932,19794,19309,27910,27910,21257,24728,24192,23642,19405,11392,22957,23482,24023,24442,24542,27718,27718,20501,25098,24562,24012,19778,21470,11550,23281,23860,24283,24385,27738,27737,20165,24940,25137,24586,19430,21960,21773,11707,24033,24455,24592,27792,27791,19949,24994,25013,25197,19211,22464,22313,22467,11845,24446,24764,27715,27715,19623,24917,24936,24936,19061,22848,22700,22854,22837,11774,24755,27158,27158,19335,24475,25092,24934,18606,22955,22810,22996,23150,23133,11858},
+        {33364,43669,43717,45814,43067,43769,39181,30646,30345,30363,30430,30358,29767,41755,33100,43091,45742,42247,42949,39132,30641,30340,30359,30425,30353,29762,41819,41232,32120,44468,41406,42109,38493,30206,29774,29792,29858,29786,29195,43266,43199,42048,24784,44738,45654,34403,22094,22240,21762,21556,21226,20925,41170,40401,39606,42307,22073,38249,28515,26640,27001,27615,27493,27421,27579,41837,41068,40273,43153,36554,21678,26046,26063,26424,27038,27690,27420,27410,37123,37079,36514,32768,27213,24918,10119,21279,20564,21189,20980,20844,20362,28813,28813,28423,21328,24984,24433,20555,11912,23739,24404,24946,25365,25464,28507,28507,27988,21407,25324,24773,19842,22232,12595,24091,24670,25093,25230,28522,28522,28003,20945,25901,25350,20399,22858,22546,12785,24885,25307,25444,28576,28576,28057,20729,25777,25961,20183,23363,23086,23287,12924,25299,25616,28499,28499,27980,20403,25701,25700,20036,23746,23474,23675,23657,12852,25607,27943,27943,27424,20114,25856,25698,19583,23853,23615,23816,23970,23953,12936},
+        {34163,44100,43932,44119,47048,44312,41394,31559,31258,31143,31231,31159,31209,42162,33900,43305,43326,46976,43492,41343,31554,31253,31138,31226,31154,31204,42022,41434,32919,42479,45703,42651,40960,31118,30686,30571,30659,30588,30610,42216,41472,40671,32138,45178,41821,40417,30197,30425,30152,30240,30169,30191,44405,44339,43188,42729,25224,45670,34402,22018,22165,22593,22275,21945,21866,42368,41599,40804,40018,43191,21927,26197,26640,27006,27562,28242,27973,28169,39174,39127,38800,38322,32768,25090,10963,21489,21521,21004,21769,21636,21409,29696,29696,29307,28433,21288,24999,20780,11983,24347,24928,25615,26034,26341,29391,29391,28872,28644,21367,25344,20757,22829,12833,24614,25360,25783,26126,29261,29260,28741,28359,21709,25866,20229,23375,23063,13514,25281,25704,26228,29341,29341,28822,28440,21398,26506,20917,24021,23765,23669,13719,25918,26443,29265,29264,28745,28363,21072,26245,20773,24405,24152,24057,24257,13648,26433,29312,29312,28768,28386,20981,26429,20547,24698,24480,24556,24757,24739,13917},
+        {34974,45216,44441,44445,45707,48131,43828,32478,32179,32065,31838,31970,31808,43220,34711,43815,43652,44887,48059,43773,32473,32174,32060,31833,31965,31803,42503,41915,33703,42785,44020,46785,43251,32011,31580,31466,31239,31371,31209,42525,41781,40960,32922,43301,46260,42889,31089,31319,31047,30820,30952,30790,43738,42968,42148,41470,32238,46156,42680,30211,30441,30864,30471,30602,30798,45408,45342,44191,43731,43654,25714,34401,21963,22111,22539,22915,22682,22571,41432,41382,40926,40617,40445,32768,11819,21536,21745,21977,21599,22441,22186,30586,30586,30172,29298,28463,21265,20857,12045,24824,25528,25991,26717,26965,30283,30283,29739,29511,28676,21346,20996,23298,12922,25235,25736,26465,26751,30153,30152,29608,29226,29068,21689,21158,23964,23672,13769,25657,26406,26873,29917,29917,29373,28990,28671,21988,20761,24393,24137,24041,14248,25727,26793,30039,30038,29494,29112,28793,21757,21522,25076,24823,24747,24073,14461,27008,29888,29888,29343,28961,28977,21638,21271,25316,25097,25193,25097,25298,14721},
+        {53508,56283,55910,55774,57131,58183,61169,47408,47011,46912,46816,46720,46023,53581,53490,55057,54687,56006,57058,61167,47404,47008,46909,46812,46717,46020,53239,52445,53176,54136,55455,56507,59945,47127,46635,46537,46440,46344,45648,53114,52103,51582,53110,55079,56131,58725,46594,46603,46373,46276,46181,45484,54385,53339,52819,52465,53375,56090,57813,46340,46349,46656,46428,46332,46611,55373,54327,53807,53453,53409,53621,56888,46067,46077,46384,46693,46465,46486,57667,57666,56541,55416,54572,53716,32768,42301,43004,44003,44998,45981,45852,45024,45023,44771,44267,44018,43751,39973,11838,35200,35719,36212,36526,37417,44650,44650,44309,44281,44031,43765,40615,33503,12043,34614,35110,35426,36321,44551,44550,44209,44058,44319,44052,41528,33994,32969,12300,35062,35379,36274,44453,44453,44112,43961,44099,44342,42438,34461,33439,33388,12537,35304,36226,44357,44356,44016,43865,44002,44123,43337,34756,33736,33686,33608,12536,36150,43707,43706,43366,43215,44260,44143,43218,35586,34569,34518,34468,34390,12804},
+        {33552,43666,43630,43470,44825,45985,48476,44680,30080,29994,29951,29757,29531,41146,33253,43593,42783,43940,45063,48399,44622,30076,29990,29947,29753,29527,41111,41073,32986,42141,43125,44220,48328,44567,30073,29988,29945,29751,29525,40984,40347,39748,31915,42229,43323,46995,44043,29581,29362,29319,29125,28899,42259,41441,40681,39840,31131,42830,46748,43986,28667,29122,28918,28724,28869,43356,42503,41717,40876,40412,30421,46677,43844,27772,28227,28734,28370,28454,45613,45540,45468,44256,44046,43999,23234,32768,18579,19051,19670,20148,19867,42125,42070,42017,41556,41521,41408,31134,8505,18024,18557,18949,18617,19502,28537,28537,28536,28117,27256,26413,17883,17502,9306,22193,23001,23516,24215,28421,28420,28420,27867,27677,26834,18268,17947,21243,10279,23135,23651,24350,28344,28344,28343,27791,27442,27302,18793,18262,21999,22090,11203,23567,24287,28128,28128,28127,27575,27226,26920,19191,17909,22474,22565,22453,11727,23552,27919,27918,27918,27365,27359,26998,18917,18717,23125,23216,23124,22405,11940},
+        {33134,43708,43363,43332,44512,45663,49056,43832,44586,29218,29205,29246,29020,41175,32812,42676,42645,43627,44741,48977,43795,44528,29214,29201,29242,29016,40862,40224,32153,41656,42638,43751,47848,43671,44185,28923,28911,28952,28726,40831,40194,39267,31903,42001,42941,47779,42833,44134,28922,28909,28950,28724,41944,41125,40199,39603,30926,42320,46725,42218,44068,28501,28356,28396,28542,43032,42179,41252,40496,39909,30180,46461,41595,43921,27606,28134,28014,28098,46164,46088,45042,44971,44014,43790,22531,46956,32768,18046,18685,19430,19149,41307,41273,41167,40386,39804,39214,44410,19366,19922,23816,24487,25206,25902,42031,41976,41666,41615,41573,41455,31134,19129,7484,17425,17921,17598,18493,27700,27700,27442,27441,27085,26242,17340,22726,16892,9246,21861,22574,23275,27651,27651,27393,27392,26904,26730,17884,23352,17307,20908,10207,22725,23447,27652,27652,27394,27393,26904,26573,18527,24023,16962,21573,21678,11004,23597,27442,27442,27184,27184,27038,26651,18253,24672,17780,22226,22351,22455,11217},
+        {32448,43576,43231,43089,44201,45176,49426,43213,43198,44439,28365,28406,28180,41041,32104,42543,42204,43316,44254,49344,43176,43162,44381,28361,28402,28176,40728,40091,31426,41214,42326,43264,48212,43052,42842,44039,28071,28111,27886,40600,39782,38855,30815,41363,42301,47086,42211,42958,43925,27809,27850,27624,41628,40809,39883,38980,30633,41919,47297,41628,42375,44153,27851,27892,28037,42553,41701,40774,39872,39509,29698,46226,40999,41746,44001,27450,27357,27442,46518,46440,45391,44346,44531,43558,21532,46484,47489,32768,17639,18384,18103,40702,40668,40563,39778,39229,38634,43961,19051,37888,19845,23676,24395,25096,40689,40655,40368,40482,39932,39337,44897,35758,18672,18376,22854,23573,24274,41888,41833,41523,41422,41627,41504,31134,19027,17644,6326,17012,16689,17585,26861,26861,26603,26371,26408,26069,16908,22569,21795,16458,9058,21834,22555,26862,26862,26604,26371,26409,25937,17552,23241,22466,16113,20839,9854,22706,26653,26652,26394,26162,26542,26016,17278,23893,23119,16931,21512,21617,10068},
+        {31763,43379,43035,42893,43930,44800,49651,42512,42505,42550,44191,27561,27336,40848,31397,42347,42008,43008,43878,49566,42476,42468,42513,44133,27558,27332,40535,39898,30700,41018,42018,42889,48432,42352,42148,42193,43791,27267,27041,40407,39589,38662,30072,41055,41926,47303,41511,42264,42077,43677,27006,26780,41372,40519,39593,38690,29532,41217,46456,40924,41678,42484,43866,26788,26933,42178,41325,40398,39496,38827,29394,46650,40354,41080,41887,44078,26849,26934,46736,46655,45603,44555,43766,43936,20537,45865,46850,47896,32768,17334,17053,40021,39987,39881,39097,38545,38008,43373,18734,37358,38042,19765,23584,24285,40014,39981,39693,39807,39255,38693,44290,35244,18349,36860,18293,22758,23459,40049,40015,39727,39625,40006,39444,45256,35878,34766,18425,17688,22997,23698,41650,41596,41286,41185,41361,41551,31134,18922,17536,16953,5191,15780,16676,26068,26068,25810,25578,25383,25438,16573,22458,21680,21891,15264,8705,21814,25859,25859,25600,25368,25517,25516,16299,23110,22332,22543,16082,20778,8919},
+        {31079,43139,42795,42653,43690,44486,49797,41797,41757,41802,41852,43816,26487,40614,30691,42107,41768,42768,43564,49709,41760,41721,41766,41815,43758,26483,40301,39664,29974,40778,41779,42574,48572,41636,41401,41446,41495,43416,26193,40174,39355,38428,29330,40815,41611,47441,40795,41517,41329,41379,43302,25932,41138,40285,39359,38456,28776,40903,46592,40209,40930,41737,41554,43491,26085,41881,41029,40102,39200,38530,28282,45728,39608,40330,41136,41947,43621,25825,46880,46796,45741,44691,43899,43094,19554,45387,46105,47151,48201,32768,15999,39326,39293,39187,38402,37850,37285,42912,18414,36776,37460,38149,19688,23470,39290,39256,38969,39083,38531,37965,43583,34683,18024,36276,36965,18208,22644,39324,39290,39003,38901,39281,38716,44549,35316,34202,18098,36993,17598,22883,39363,39329,39041,38940,39104,39471,45519,35953,34839,34857,18217,16959,23121,41294,41240,40930,40829,41005,41127,31134,18820,17426,16838,16222,4083,15766,25061,25061,24803,24570,24719,24487,15316,22323,21545,21757,21968,15232,7770},
+        {31132,43387,43042,42900,43769,44782,50302,42294,42010,42055,42104,42129,43062,40842,30722,42355,42015,42847,43860,50212,42257,41973,42018,42067,42092,43004,40528,39891,29986,41026,41857,42870,49072,42133,41653,41698,41748,41772,42661,40401,39582,38656,29325,40894,41907,47938,41292,41769,41582,41631,41656,42547,41211,40359,39432,38530,28804,40981,46820,40488,40965,41772,41588,41613,43636,42161,41309,40382,39480,38603,28530,45986,39948,40425,41232,42015,41835,43654,47370,47283,46226,45173,44126,43349,19683,45668,46386,47432,48482,49536,32768,39792,39759,39653,38868,38109,37602,43184,18890,36946,37631,38292,38804,20165,39532,39498,39210,39324,38565,38058,43855,34856,18493,36446,37107,37619,18542,39566,39532,39245,39143,39316,38809,44821,35489,34376,18564,37135,37647,17877,39604,39571,39283,39181,39139,39537,45791,36100,34986,35004,18646,37652,17453,39619,39586,39298,39196,39154,39364,46765,36568,35454,35472,35467,18568,17083,40598,40544,40234,40133,41140,41158,31134,19267,17740,17100,16683,16315,4361},
+        {24261,46242,46203,45897,46899,47827,47895,34415,20237,19888,19716,19594,19035,43652,22824,38496,38188,38902,39324,40269,32583,26224,26248,26349,26459,25731,43615,36730,22507,37567,38099,38487,39432,32499,26221,26245,26346,26455,25728,43338,36446,35856,21873,37144,37532,38478,30326,26153,25989,26089,26199,25472,44261,37116,36354,35452,21401,36582,37553,27830,25559,26164,26076,26186,26094,45118,37509,36715,35813,34904,20769,36621,25325,24763,25367,26049,25969,25701,45184,38418,37625,36722,35839,34949,20511,23410,24228,24833,25514,26209,25743,32768,30913,30833,28830,26514,24186,22404,7734,19079,18808,18599,18465,18061,19555,24536,24536,24482,23915,23157,22653,18469,10295,21889,22490,23075,23297,19205,24550,24550,24318,24483,23725,23221,18195,20452,10452,22697,23281,23503,19020,24636,24636,24404,24391,24365,23862,17978,21014,21200,10625,23454,23676,18884,24731,24730,24499,24486,24282,24514,17833,21559,21745,21900,10771,23667,18353,24041,24041,23810,24397,24029,24076,17448,21766,21952,22107,22089,10515},
+        {32225,46743,41543,41235,42113,42792,42543,36491,28767,28791,28892,29001,28156,44139,23994,45348,45042,46043,46972,47888,34409,20334,19986,19814,19692,19133,39673,42835,22623,37929,38486,39013,39433,32679,26297,26321,26422,26531,25800,39389,42559,36213,21990,37531,38059,38478,30402,26229,26065,26165,26275,25544,40219,43481,36737,35834,21552,37134,37554,27929,25670,26274,26186,26296,26196,40863,44338,37234,36332,35448,21110,36622,25634,25054,25659,26340,26261,25992,40627,45184,37625,36722,35839,34949,20512,23465,24262,24867,25548,26242,25776,34622,32768,31007,28908,26613,24478,22456,7996,19392,19124,18917,18786,18385,26999,19651,24615,24561,24026,23439,22685,18759,10561,22133,22735,23319,23541,27013,19300,24629,24397,24594,24007,23253,18487,20684,10718,22941,23526,23748,27099,19115,24714,24483,24502,24647,23893,18273,21245,21432,10891,23699,23921,27193,18979,24809,24578,24597,24565,24545,18131,21791,21977,22131,11037,23912,26390,18448,24116,23885,24501,24311,24108,17748,21998,22184,22338,22321,10780},
+        {32225,43613,46739,41258,42143,42849,42599,36574,28800,28824,28925,29035,28186,41689,31617,45681,40436,41321,42026,42729,36376,28548,28572,28673,28783,27934,44136,43164,23663,44297,45091,45985,46901,34405,20330,19982,19810,19688,19129,39411,38639,41873,21984,37727,38287,38872,30447,26085,25948,26048,26158,25427,40248,39476,42606,36029,21546,37363,37948,27977,25526,26130,26042,26152,26052,40917,40145,43432,36559,35676,21138,37042,25685,24944,25549,26230,26151,25883,40681,40812,44278,37112,36228,35363,20764,23518,24368,24972,25654,26348,25882,34702,34528,32768,28950,26658,24526,22506,7997,19464,19198,18994,18866,18468,27030,26804,19651,24426,23891,23337,22786,18826,10561,22163,22764,23349,23571,27044,26818,19300,24288,24459,23905,23354,18558,20711,10718,22971,23555,23777,27130,26904,19115,24374,24368,24545,23994,18346,21273,21459,10891,23728,23950,27225,26998,18979,24468,24462,24462,24646,18206,21818,22004,22158,11037,23941,26417,26191,18448,23775,24367,24209,24209,17826,22025,22211,22365,22348,10781},
+        {32951,43915,43881,46813,42918,43627,43377,38734,29626,29638,29738,29848,28999,41985,32343,42940,45755,42095,42804,43507,38641,29374,29386,29486,29596,28747,41951,41064,32091,45685,41307,41989,42692,38595,29371,29382,29483,29593,28744,44209,43237,43172,24154,44982,45880,46797,34403,21314,20821,20648,20526,19967,41004,40232,39492,42531,22050,38261,38846,28465,26307,26915,26827,26936,26836,41678,40906,40140,43361,36549,21643,37940,25993,25726,26334,27015,26936,26667,41442,41573,40807,44207,37102,36237,21268,23979,25149,25757,26438,27133,26667,36705,36627,36585,32768,27140,24842,22963,9122,19534,20243,20042,19917,19521,27820,27594,27593,20557,24653,24098,23547,18890,11607,23007,23608,24193,24415,27828,27602,27602,20080,25223,24669,24118,19527,21517,11796,23823,24407,24629,27914,27688,27688,19895,25132,25309,24758,19318,22078,22279,11969,24580,24802,28009,27783,27783,19759,25227,25226,25411,19181,22623,22824,22978,12115,24793,27201,26975,26975,19228,25131,24973,24973,18803,22830,23031,23185,23168,11859},
+        {33747,44106,44072,44091,47992,44169,43958,41235,30538,30452,30540,30649,30441,42165,33139,43131,43150,46934,43347,44053,41118,30286,30199,30287,30397,30162,42132,41245,32887,42530,46864,42532,43239,41069,30283,30196,30284,30394,30159,42168,41282,40698,31920,45593,41696,42403,40521,29849,29631,29719,29829,29593,45296,44324,44259,43109,24574,45894,46815,34402,21239,21685,21367,21245,20908,42209,41437,40672,39880,43397,21892,38800,26150,26308,26883,27567,27488,27426,42009,42108,41343,40551,44247,37072,21517,24014,25731,26306,26990,27685,27426,39021,38922,38877,38395,32768,25020,23027,9968,20491,20058,20831,20708,20568,28703,28477,28477,28088,20517,24669,24118,19806,11845,23556,24298,24883,25312,28599,28373,28372,27853,20875,25210,24659,19356,22058,12560,24400,24985,25414,28680,28453,28453,27934,20564,25853,25303,20053,22757,22833,12765,25199,25628,28774,28548,28548,28029,20428,25771,25955,19918,23302,23378,23579,12911,25619,28571,28320,28319,27800,20095,25704,25704,19767,23695,23771,23972,23955,12840},
+        {34556,44540,44506,44342,45601,48966,44737,43743,31460,31373,31328,31460,31040,42575,33920,43544,43381,44640,47907,44616,43416,31181,31094,31049,31180,30761,42541,41635,33668,42760,43852,47838,43801,43365,31177,31090,31046,31177,30757,42406,41500,40916,32700,43010,46567,42966,42996,30743,30525,30480,30611,30192,43616,42709,41969,41172,31980,46300,42371,42782,29864,30306,30104,30235,30173,46197,45226,45161,44011,43786,25050,46814,34401,21181,21627,22215,21982,21614,42764,42659,41893,41102,40536,44270,21784,24127,26321,26901,27527,28250,27933,41349,41057,41009,40693,40515,32768,23164,10829,20716,21030,20662,21513,21345,29595,29344,29344,28955,28119,20492,24697,20045,11933,24177,24835,25565,25936,29491,29240,29239,28720,28531,20851,25243,20286,22667,12814,24937,25688,26059,29427,29175,29175,28656,28312,21345,25831,19897,23285,23361,13511,25609,25979,29548,29297,29297,28778,28433,21113,26511,20667,23973,24068,23973,13724,26194,29146,28895,28895,28376,28367,20752,26206,20491,24313,24408,24312,24513,13644},
+        {35016,44694,44659,44495,45754,46833,49029,45647,32101,32016,31971,31788,31572,42724,34732,44624,43853,44929,45974,48954,45590,32096,32011,31966,31783,31567,42691,42659,34479,43232,44142,45160,48885,45536,32093,32008,31963,31780,31564,42555,41946,41362,33484,43279,44297,47612,45014,31631,31415,31370,31187,30971,43765,42984,42244,41427,32763,43814,47346,44922,30752,31196,30994,30810,30952,44806,43993,43228,42411,41953,32114,47241,44752,29891,30335,30828,30478,30562,46264,46195,46130,44980,44755,44678,25562,34401,21125,21574,22162,22623,22351,43131,43079,43029,42572,42508,42371,32768,11685,20746,21254,21632,21342,22148,30230,30230,30230,29816,28980,28160,20469,20106,11994,24650,25431,25937,26614,30128,30128,30127,29583,29394,28574,20830,20524,23133,12903,25553,26059,26737,30064,30063,30063,29519,29175,29033,21324,20825,23871,23966,13766,25980,26678,29869,29869,29868,29324,28980,28677,21703,20510,24341,24436,24341,14252,25999,29665,29665,29665,29121,29112,28755,21436,21239,24980,25075,24999,24325,14457},
+        {53596,56083,56081,55709,57028,58080,57983,61312,47510,47419,47331,47244,46183,53398,53304,54928,54556,55875,56927,57979,61023,47247,47156,47068,46982,45921,53396,52318,53288,53704,54788,55803,56855,61021,47245,47154,47066,46979,45918,53054,51976,51182,52976,54239,55253,56305,59800,46968,46783,46694,46608,45547,54290,53212,52201,51680,53203,55184,56236,58885,46714,47029,46808,46722,46637,55279,54200,53155,52635,52563,53450,56176,57955,46441,46756,47074,46855,46512,55189,55189,54143,53623,53552,53490,53697,57030,46169,46484,46801,47121,46645,57801,57539,57538,56413,55567,54706,53850,32768,42411,43419,44428,45434,46170,45121,44883,44882,44630,44381,44114,43848,40078,11796,35273,35800,36300,36392,45029,44791,44790,44450,44676,44410,44143,40999,33572,12053,35753,36253,36345,44939,44701,44701,44360,44464,44707,44441,41921,34070,34020,12327,36206,36297,44851,44613,44613,44272,44376,44497,44740,42841,34544,34494,34443,12572,36222,43858,43619,43619,43278,44289,44173,44293,43515,34636,34585,34535,34457,12543},
+        {33698,43786,43750,43719,44702,45815,46096,49362,46453,29955,29945,29986,29666,41261,33311,42822,42791,43774,44887,46059,49025,46134,29890,29880,29921,29601,41226,40365,33024,42760,43092,44007,45142,48951,46076,29888,29877,29918,29599,41195,40334,40301,32773,42455,43197,44303,48881,46022,29886,29875,29917,29597,42126,41266,40633,40037,31768,42555,43661,47827,45775,29437,29294,29335,29386,43180,42319,41505,40749,40141,31022,43154,47563,45713,28542,29072,28952,28943,43460,43427,42578,41796,41188,40711,30335,47511,45613,27647,28177,28759,28589,46456,46143,46071,46001,45044,44819,44789,23124,32768,18012,18654,19399,20100,43785,43491,43436,43382,43174,43135,43061,31134,8409,17459,18182,18666,18297,28421,28365,28365,28364,27983,27140,26297,17340,16963,9305,22360,23201,23864,28374,28319,28318,28318,27803,27630,26787,17886,17586,21396,10295,23373,24036,28375,28320,28319,28319,27804,27473,27325,18529,17988,22184,22309,11265,24186,28043,27988,27988,27987,27815,27429,27123,19132,17601,22804,22929,23033,12052},
+        {33010,43620,43584,43244,44356,45294,45558,49644,43969,46359,29105,29146,28826,41096,32600,42656,42316,43428,44366,45521,49304,43701,46040,29040,29081,28761,41060,40200,32294,41634,42746,43487,44604,49227,43670,45982,29037,29078,28759,40751,39891,39258,31654,41761,42502,43620,48100,43551,45640,28747,28788,28469,41779,40918,40285,39363,31472,42120,43064,48311,42967,45866,28789,28831,28882,42670,41810,40995,40073,39710,30537,42429,47240,42338,45795,28388,28296,28286,42935,42902,42053,41131,40607,40007,29816,46978,41719,45690,27493,28075,27904,46727,46411,46337,45292,45477,44505,44281,22116,47523,32768,17603,18349,19054,41434,41189,41160,41058,40509,39914,39328,44952,18944,18452,23469,24194,24863,43691,43397,43342,43031,43233,43187,43107,31134,17753,7256,17273,17757,17388,27584,27529,27528,27270,27308,26969,26126,16907,22394,16737,9146,22482,23145,27585,27530,27530,27271,27309,26837,26664,17550,23071,17139,21470,10116,23295,27253,27198,27198,26940,27320,26793,26462,18157,23697,16752,22090,22195,10903},
+        {32322,43420,43384,43044,44044,44914,45004,49860,43275,43324,46226,28301,27982,40899,31890,42456,42116,43116,43987,44966,49517,43008,43057,45907,28236,27917,40864,40003,31565,41434,42237,43107,44050,49438,42976,43025,45850,28234,27914,40555,39694,39061,30908,41252,42122,43065,48308,42857,42711,45508,27944,27625,41485,40625,39810,38888,30368,41414,42356,47462,42270,43081,45671,27726,27778,42291,41431,40616,39694,39024,30230,41960,47655,41673,42484,45880,27787,27778,42394,42360,41512,40589,39920,39544,29323,46586,41048,41859,45770,27386,27243,46936,46618,46541,45493,44704,44873,43903,21107,46881,47932,32768,17299,18004,40759,40515,40485,40384,39831,39269,38678,44343,18621,37755,18375,23379,24048,40798,40553,40524,40240,40587,40024,39433,45313,35626,18697,17723,23618,24287,43561,43267,43212,42901,43053,43241,43156,31134,17651,17023,6124,16848,16479,26791,26736,26736,26478,26283,26338,25999,16571,22284,22495,16291,8967,22404,26459,26404,26404,26146,26294,26294,25822,17178,22910,23122,15904,21356,9754},
+        {31635,43177,43141,42801,43802,44597,44581,49996,42528,42577,42626,46021,27133,40663,31181,42213,41874,42874,43670,44544,49650,42260,42310,42359,45702,27068,40627,39767,30837,41191,41994,42753,43627,49568,42229,42278,42327,45645,27066,40318,39458,38825,30163,41010,41768,42643,48436,42110,41964,42013,45302,26776,41249,40388,39574,38651,29610,41059,41934,47586,41523,42334,42150,45465,26929,41992,41131,40283,39360,38691,29116,41211,46723,40922,41733,42544,45635,26670,41975,41942,41093,40170,39501,38818,29009,46918,40329,41140,41951,45847,26731,47070,46749,46669,45618,44827,44022,44193,20101,46136,47186,48236,32768,16950,40035,39790,39761,39659,39107,38542,37984,43636,18296,37171,37860,18296,23233,40073,39829,39799,39516,39862,39297,38739,44606,35063,18370,37888,17641,23472,40112,39867,39838,39554,39685,40052,39494,45576,35700,35718,18489,17225,23711,43363,43069,43014,42703,42855,43014,43203,31134,17546,16916,16507,5017,15570,25662,25606,25606,25348,25497,25264,25319,16195,22123,22335,22546,15054,8605},
+        {30902,43096,43060,42720,43551,44564,44474,50415,41991,42037,42086,42139,44820,40573,30426,42132,41792,42624,43637,44437,50067,41724,41769,41818,41872,44501,40538,39677,30062,41110,41744,42720,43520,49982,41693,41738,41787,41840,44444,40229,39368,38735,29372,40759,41735,42535,48847,41573,41423,41472,41526,44101,41005,40144,39330,38407,28852,40809,41609,47729,40769,41576,41392,41446,45165,41955,41094,40246,39323,38447,28577,40947,46895,40229,41036,41847,41667,45222,41875,41842,40993,40071,39194,38570,28118,46033,39633,40439,41250,42065,45370,47474,47150,47067,46014,44967,44190,43387,19365,45435,46481,47531,48585,32768,39511,39267,39237,39136,38377,37870,37309,42972,18228,36639,37328,38021,18331,39546,39301,39272,38988,39128,38621,38060,43938,34549,18298,37356,38049,17668,39584,39340,39310,39027,38950,39376,38815,44908,35186,35204,18417,38081,17248,39627,39382,39353,39069,38993,39202,39574,45882,35828,35846,35868,18584,16881,42244,41950,41895,41585,42568,42623,42761,31134,17548,16910,16496,16131,4075},
+        {24421,47096,46819,46786,47579,48473,48557,48733,34415,19694,19507,19419,19102,44464,22960,38634,38601,39132,39520,40472,40393,32583,26097,26191,26335,25824,44208,36863,22586,37769,38300,38688,39640,40358,32364,26035,26129,26273,25762,44175,36830,36042,22286,37685,37890,38808,39526,30783,26033,26127,26271,25760,44907,37329,36541,35955,21798,36939,37883,38601,28196,26181,26086,26230,26355,45733,37690,36901,36144,35235,21153,36949,37667,25481,25385,26059,26014,25961,45814,38605,37817,37028,36144,35252,20885,36998,23504,24846,25521,26245,26003,45980,38536,38505,37715,36832,35940,35305,20414,21750,24101,24776,25500,26024,32768,30913,30711,29248,26849,24326,22487,20852,7642,18486,18376,18251,17857,19035,24416,24362,24361,24501,23743,23236,22532,17901,10293,22042,22649,23059,18836,24495,24441,24441,24403,24377,23870,23166,17778,20594,10466,22855,23265,18731,24622,24568,24568,24530,24326,24551,23848,17641,21161,21347,10646,23472,18421,24136,24082,24082,24645,24276,24324,24348,17265,21551,21737,21924,10641},
+        {32361,47622,41682,41648,42343,42989,42746,42935,36491,28640,28734,28878,28249,44974,24131,45964,45931,46724,47618,48551,48622,34409,19792,19604,19516,19199,39806,43428,22703,38130,38687,39214,39641,40590,32544,26111,26205,26349,25834,39773,43395,36399,22403,38071,38417,38809,39758,30859,26109,26203,26347,25832,40432,44127,36923,36337,21949,37492,37884,38833,28296,26291,26197,26341,26456,41044,44953,37420,36663,35779,21494,36950,37925,25791,25676,26351,26306,26253,40814,45814,37817,37028,36144,35252,20885,36998,23559,24880,25554,26279,26037,40999,45884,38731,37941,37058,36191,35305,20652,22044,24346,25020,25745,26268,34622,32768,30884,29326,26948,24619,22539,21124,7904,18802,18694,18572,18181,26878,19131,24440,24440,24612,24025,23267,22764,18193,10559,22287,22894,23303,26958,18931,24520,24520,24514,24659,23901,23398,18073,20826,10732,23100,23510,27085,18826,24647,24647,24641,24608,24582,24079,17939,21392,21579,10912,23717,26485,18516,24157,24157,24749,24559,24355,24580,17565,21783,21969,22155,10907},
+        {32572,44021,47514,41860,42555,43226,42983,42935,36707,28884,28978,29122,28489,42076,31943,46453,41038,41732,42404,43087,42842,36509,28632,28726,28870,28237,44876,43901,23881,45078,45871,46765,47698,48618,34405,19892,19704,19616,19299,39980,39208,42615,22520,38433,38803,39335,39759,31023,26181,26275,26419,25904,40638,39866,43348,36694,22065,37878,38410,38834,28372,26363,26269,26413,26528,41275,40503,44173,37045,36162,21645,37502,37926,25891,25782,26457,26412,26359,41046,41151,45034,37547,36663,35796,21226,36999,23869,25167,25842,26566,26325,40999,40920,45884,37942,37058,36191,35305,20653,22099,24375,25050,25774,26298,34824,34651,32768,29485,27027,24719,22832,21177,8166,19114,19009,18889,18501,27110,26884,19226,24515,24687,24132,23545,22791,18482,10825,22528,23134,23544,27189,26963,19026,24595,24589,24766,24179,23425,18364,21053,10997,23341,23751,27316,27090,18921,24722,24716,24715,24861,24106,18233,21620,21806,11178,23957,26712,26486,18611,24232,24824,24666,24633,24607,17862,22010,22196,22382,11173},
+        {32572,44021,43909,47511,42578,43257,43014,42992,38286,28913,29007,29151,28518,42077,31944,42968,46450,41756,42434,43144,42898,38193,28661,28755,28899,28266,41975,41089,31349,45395,40939,41617,42326,43033,38013,28411,28505,28649,28016,44873,43899,42929,23568,45127,45814,46712,47633,34403,19889,19701,19613,19297,40660,39888,39120,42662,22060,38074,38639,39228,28418,26215,26147,26291,26407,41304,40532,39764,43298,36357,21639,37731,38320,25939,25634,26309,26264,26211,41075,41206,40437,44128,36891,36024,21254,37418,23920,25053,25728,26452,26211,41053,40974,41109,44978,37447,36580,35719,20905,22153,24477,25151,25876,26399,36287,36209,36050,32768,27070,24764,22880,21228,8166,19184,19082,18965,18580,27137,26911,26685,19226,24548,23994,23439,22888,18548,10825,22553,23159,23569,27217,26990,26764,19026,24476,24628,24073,23522,18434,21077,10998,23366,23776,27344,27117,26891,18921,24603,24577,24754,24204,18305,21643,21830,11178,23982,26739,26513,26287,18611,24710,24527,24527,24704,17936,22033,22220,22406,11174},
+        {33366,44209,44063,44034,48681,43799,43595,43572,40877,29727,29809,29953,29960,42255,32738,43122,43093,47620,42977,43690,43445,40761,29475,29556,29700,29681,42121,41235,32143,42158,46564,42159,42873,43580,40668,29225,29306,29450,29431,42092,41206,40323,31907,46497,41377,42063,42770,40623,29223,29304,29448,29429,45951,44977,44007,43942,23960,45828,46730,47651,34402,20754,20420,20332,20237,41836,41064,40295,39559,43334,21889,38591,39180,26100,26184,26861,26816,26970,41642,41741,40973,40211,44168,36859,21504,38279,23962,25603,26280,27004,26970,41620,41509,41644,40882,45018,37416,36555,21154,22361,25026,25704,26428,27158,38686,38587,38508,38465,32768,24946,22951,21452,9013,18999,19871,19757,19627,27907,27681,27455,27455,20022,24535,23980,23430,18378,11588,23164,23771,24388,27982,27756,27530,27529,19696,25172,24617,24067,19168,21662,11794,23985,24602,28109,27883,27656,27656,19590,25121,25299,24748,19042,22229,22430,11974,24809,28109,27857,27631,27631,19478,25258,25258,25435,18900,22805,23006,23192,12154},
+        {34172,44626,44297,44268,45359,49615,44374,44356,43597,30649,30632,30763,30559,42648,33516,43336,43307,44397,48554,44253,44045,43269,30369,30352,30483,30280,42344,41437,32922,42372,43462,47498,43435,44146,43153,30119,30102,30233,30029,42315,41408,40525,32685,42847,47431,42626,43337,43105,30117,30100,30231,30027,43366,42460,41577,40997,31780,46417,42026,42737,42886,29725,29576,29708,29862,46815,45841,44870,44806,43891,24419,46728,47652,34401,20696,21303,21069,20943,42397,42292,41523,40762,40191,44189,21770,39122,24080,26198,26842,27570,27477,42378,42096,42198,41437,40866,45043,37375,21421,22400,25621,26266,26993,27665,41209,40916,40816,40771,40589,32768,23093,21520,9877,19971,19701,20561,20403,28800,28548,28322,28322,27970,19997,24564,24013,19308,11843,23726,24474,25032,28761,28510,28283,28283,27802,20507,25171,24620,19012,22216,12574,24610,25169,28883,28631,28405,28405,27924,20275,25855,25304,19791,22920,23027,12787,25383,28684,28433,28207,28206,28060,20135,25761,25938,19624,23442,23550,23751,12959},
+        {34629,44735,44406,44377,45467,46536,49590,44861,45562,31292,31274,31307,31091,42755,34325,43764,43734,44642,45677,49513,44825,45505,31287,31270,31302,31086,42451,41841,33703,42779,43687,44722,48456,44709,45179,31009,30992,31024,30808,42421,41812,40909,33466,43071,43939,48389,43899,45128,31007,30990,31022,30806,43473,42692,41789,41210,32561,43333,47376,43299,45029,30615,30466,30499,30641,44505,43692,42789,42053,41476,31877,47094,42692,44854,29754,30266,30140,30223,46799,46728,45757,45693,44778,44539,24920,47652,34401,20638,21245,21952,21680,42882,42850,42749,41988,41417,40838,45066,21687,22474,26207,26857,27551,28226,43048,42996,42703,42655,42584,42442,32768,21621,10738,20195,20672,20391,21206,29437,29436,29185,29185,28833,28014,19972,24587,19546,11932,24343,25032,25711,29398,29398,29146,29146,28665,28491,20482,25200,19941,22821,12829,25168,25867,29407,29407,29155,29155,28674,28345,21086,25854,19634,23469,23577,13567,26004,29203,29203,28952,28951,28805,28423,20820,26490,20372,24109,24237,24345,13771},
+        {35152,44806,44772,44743,45650,46685,46937,49871,47308,31987,31972,32004,31689,42833,34784,43897,43868,44776,45811,46901,49555,47009,31923,31908,31941,31626,42799,41971,34514,43838,44139,44991,46047,49483,46953,31920,31905,31938,31623,42770,41942,41915,34277,43523,44209,45238,49416,46899,31918,31903,31936,31621,43650,42822,42216,41637,33345,43582,44611,48402,46633,31499,31352,31385,31428,44650,43822,43045,42309,41712,32661,44116,48120,46537,30638,31151,31026,31011,44905,44874,44065,43303,42706,42237,32032,48033,46406,29777,30291,30852,30679,47066,46776,46709,46645,45729,45490,45429,25457,34401,20583,21192,21899,22563,44683,44411,44358,44307,44083,44015,43914,32768,11593,20208,20894,21360,21034,30122,30068,30067,30067,29690,28871,28051,19949,19591,11993,24812,25624,26264,30085,30031,30031,30031,29524,29351,28531,20461,20178,23283,12917,25781,26421,30094,30040,30040,30039,29533,29205,29056,21066,20561,24051,24178,13822,26557,29777,29723,29723,29723,29552,29169,28866,21631,20213,24655,24783,24890,14552},
+        {53651,56137,55848,55846,56930,57944,57848,58037,61408,47932,47849,47768,46714,53449,53359,54695,54693,55777,56791,57843,57747,61120,47670,47587,47506,46451,53182,52103,53069,53541,54625,55639,56691,57743,60832,47408,47325,47244,46190,53180,52102,51024,53054,53774,54553,55568,56620,60831,47406,47324,47243,46188,54199,53121,52043,51249,53036,54310,55325,56377,59915,47408,47230,47149,47071,55153,54075,52997,51985,51748,53245,55237,56289,58981,47135,47458,47245,46908,55064,55063,53985,52940,52702,52613,53492,56229,58051,46863,47186,47511,47042,55240,54974,54974,53928,53690,53602,53541,53739,57126,46591,46914,47239,47307,57893,57631,57369,57369,56522,55658,54797,53942,32768,42518,43533,44550,45306,45513,45275,45037,45037,45039,44773,44506,44240,40178,11806,36540,37068,37369,45429,45191,44953,44952,44866,45075,44809,44542,41106,34738,12080,37021,37321,45346,45108,44870,44869,44784,44870,45114,44847,42036,35239,35188,12362,37274,44358,44120,43882,43882,44703,44552,44673,44916,42728,35531,35480,35430,12616},
+        {33838,44029,43763,43732,44806,45547,45774,46296,49981,47949,30089,30132,29813,41487,33428,42835,42804,43878,44619,45736,46029,49641,47627,30024,30067,29748,41241,40381,33056,41882,42956,43696,44814,45997,49306,47309,29960,30003,29684,41210,40350,39494,32788,42929,43019,43939,45085,49234,47251,29958,30001,29682,42203,41343,40486,40458,32605,42637,43383,44501,49444,47473,30000,30043,30095,42913,42053,41197,40567,40205,31642,42727,43845,48373,47208,29570,29480,29471,43144,43111,42254,41444,40921,40300,30921,43342,48110,47159,28675,29259,29089,43646,43402,43372,42528,41979,41358,40885,30262,48076,47083,27780,28364,28896,47049,46733,46421,46351,46536,45564,45340,45327,23017,32768,17580,18328,19034,45189,44892,44597,44542,44741,44515,44489,44436,31134,8503,17330,18078,18779,28542,28487,28431,28431,28469,28104,27261,26418,16925,16838,9326,23185,23996,28545,28490,28435,28434,28472,27975,27801,26958,17571,17483,22154,10324,24168,28214,28159,28103,28103,28483,27931,27599,27451,18177,18085,22918,23043,11313},
+        {33147,43788,43522,43491,44256,45126,45178,45676,50092,44324,47855,29287,28968,41252,32715,42594,42563,43328,44198,45141,45409,49750,44057,47533,29222,28903,41006,40146,32324,41640,42405,43276,44218,45377,49412,43795,47214,29159,28839,40975,40115,39259,32039,41728,42598,43344,44465,49337,43768,47157,29157,28838,41690,40830,39973,39345,31470,41868,42613,43735,48490,43903,47092,28911,28962,42496,41635,40779,40150,39460,31333,42217,43165,48683,43306,47298,28972,28963,42564,42531,41675,40865,40175,39799,30425,42534,47614,42681,47242,28570,28428,43045,42800,42771,41927,41237,40700,40104,29735,47353,42066,47160,27675,28207,47159,46841,46526,46453,45664,45834,44863,44641,22002,47955,32768,17274,17979,41763,41519,41279,41253,41384,40822,40231,39650,45366,19118,17839,24458,25132,45095,44798,44503,44447,44390,44574,44540,44483,31134,17178,7377,17169,17870,27752,27696,27641,27641,27421,27475,27136,26293,16587,23311,16635,9175,23277,27420,27365,27309,27309,27432,27431,26960,26786,17194,23943,17236,22204,10163},
+        {32457,43541,43275,43244,44009,44768,44752,45075,50219,43577,43630,47736,28120,41012,32003,42347,42316,43081,43840,44714,44808,49873,43309,43363,47415,28055,40766,39905,31593,41394,42159,42917,43792,44776,49533,43047,43101,47096,27991,40735,39875,39018,31292,41482,42043,42917,43864,49456,43021,43074,47039,27989,41450,40589,39733,39104,30709,41312,42187,43134,48606,43156,43014,46974,28114,42159,41298,40442,39632,38942,30216,41464,42411,47742,42555,43370,47118,27854,42142,42109,41252,40442,39752,39070,30109,42019,47937,41962,42777,47327,27916,42460,42216,42186,41342,40652,39970,39598,29235,46869,41341,42156,47239,27514,47284,46963,46646,46570,45778,44974,45144,44175,20985,47207,48261,32768,16925,41039,40795,40554,40529,40660,40094,39536,38950,44658,18790,39033,17762,24317,41081,40837,40597,40571,40520,40854,40296,39709,45632,36820,18909,17285,24556,44978,44681,44386,44331,44273,44408,44594,44532,31134,17076,16610,6272,16961,26622,26567,26512,26511,26634,26402,26456,26118,16211,23156,23367,16387,9014},
+        {31721,43420,43154,43123,43756,44732,44642,44860,50628,43036,43090,43143,46655,40886,31245,42226,42195,42828,43804,44604,44593,50280,42769,42822,42876,46333,40640,39779,30815,41272,41906,42881,43682,44561,49936,42507,42560,42613,46015,40609,39748,38892,30498,41229,42007,42770,43649,49856,42480,42533,42587,45957,41203,40343,39487,38858,29948,41059,41822,42701,48737,42398,42256,42309,46792,42119,41259,40403,39592,38695,29674,41160,42039,47904,41858,42673,42493,46824,42040,42006,41150,40305,39409,38784,29214,41320,47042,41261,42076,42891,46993,42238,41994,41964,41120,40223,39599,38921,29143,47238,40672,41487,42302,47204,47678,47354,47034,46955,45908,45132,44329,44501,20229,46501,47556,48610,32768,40511,40267,40027,40001,39925,39418,38857,38303,43989,18719,38501,39194,17795,40554,40309,40069,40044,39786,40177,39616,39062,44963,36306,18838,39226,17316,40596,40352,40112,40086,39828,40004,40376,39822,45937,36948,36970,19005,17210,43971,43675,43380,43324,44097,44129,44286,44475,31134,17076,16607,16482,5331},
+        {24309,47652,47375,47103,48169,48855,48905,49097,49275,34415,19278,19190,18873,44996,22822,38776,38529,39334,39539,40457,40384,40521,32583,25989,26133,25621,44740,36996,22428,37697,38502,38707,39625,40350,40273,32364,25927,26071,25559,44489,36763,35974,22074,37675,37880,38798,39523,40243,30649,25866,26010,25499,45464,37513,36724,35940,21921,37268,38030,38720,39441,28637,26080,26223,26348,46100,37702,36914,36129,35537,21263,37096,37786,38507,25775,26025,25980,25927,46150,38586,37797,37013,36274,35382,20984,37114,37835,23647,25486,26211,25969,46330,38522,38491,37707,36936,36044,35407,20506,37114,21844,24737,25462,25989,46500,38657,38425,38398,37628,36735,36098,35413,20022,20346,23772,24496,25024,32768,30913,30711,29125,27251,24594,22615,20934,19538,7429,18272,18147,17754,18626,24303,24249,24195,24388,24337,23830,23123,22213,17683,10201,22644,23054,18521,24430,24376,24322,24515,24286,24511,23804,22894,17546,21147,10381,23261,18211,23944,23890,23836,24630,24237,24284,24309,23399,17170,21537,21724,10376},
+        {32250,48202,41823,41576,42545,43008,42731,42927,43063,36492,28531,28675,28046,45530,23996,46520,46248,47314,48000,48899,48986,49165,34409,19376,19288,18971,39939,43960,22545,38058,38889,39234,39626,40582,40505,32545,26003,26147,25631,39706,43709,36331,22190,38062,38407,38799,39755,40476,30725,25942,26086,25571,40615,44684,37107,36322,22072,37821,38030,38952,39673,28737,26190,26334,26449,41056,45320,37433,36648,36081,21604,37096,38044,38765,26084,26316,26271,26219,40795,46150,37798,37013,36275,35383,20985,37115,37835,23702,25520,26245,26003,40985,46235,38717,37933,37162,36295,35407,20744,37170,22138,24982,25706,26234,41119,46404,38651,38624,37854,36987,36099,35467,20260,20643,24016,24740,25268,34622,32768,30884,29203,27350,24886,22667,21207,19813,7691,18591,18468,18078,26766,18722,24328,24274,24499,24619,23861,23354,22444,17978,10467,22889,23299,26893,18617,24455,24401,24626,24569,24542,24035,23126,17844,21379,10647,23506,26292,18306,23965,23911,24734,24519,24315,24540,23630,17470,21769,21955,10642},
+        {32461,44162,48094,41788,42757,43245,42968,42927,43119,36707,28776,28920,28286,42209,31812,47030,40965,41934,42423,43072,42833,43025,36509,28524,28668,28034,45431,44454,23726,45395,46461,47148,48046,48982,49057,34405,19475,19387,19070,39912,39140,42929,22307,38423,38793,39325,39756,40708,30889,26014,26158,25643,40822,40050,43905,36679,22189,38208,38557,38953,39905,28813,26262,26406,26521,41287,40515,44540,37030,36463,21755,37649,38045,38997,26184,26423,26378,26325,41026,41132,45370,37532,36794,35927,21326,37115,38093,24012,25808,26532,26290,40985,40906,46235,37933,37163,36296,35408,20745,37170,22193,25011,25736,26263,41173,41095,46309,38850,38080,37213,36350,35468,20498,20938,24256,24981,25508,34824,34651,32768,29362,27429,24986,22960,21260,20086,7953,18905,18786,18398,26997,26771,18817,24349,24574,24726,24140,23382,22672,18269,10732,23130,23539,27124,26898,18712,24476,24701,24676,24821,24063,23353,18137,21606,10913,23746,26520,26294,18401,23986,24809,24626,24594,24567,23858,17766,21996,22182,10908},
+        {32672,44218,44105,47987,42969,43457,43180,43165,43119,38420,29016,29160,28527,42263,32023,43165,46924,42146,42635,43310,43071,43026,38327,28764,28908,28275,42162,41275,31411,45866,41329,41817,42493,43181,42938,38146,28513,28657,28024,45334,44357,43384,23497,45610,46296,47195,48131,49055,34403,19577,19489,19172,41028,40256,39488,43125,22306,38569,38944,39480,39906,28961,26330,26474,26589,41494,40722,39954,43760,36820,21872,38036,38571,38998,26261,26490,26445,26393,41233,41363,40595,44590,37176,36309,21477,37668,38094,24113,25910,26634,26392,41217,41138,41247,45455,37682,36815,35952,21085,37171,22504,25295,26019,26547,41174,41095,41020,46309,38080,37213,36350,35468,20498,20993,24282,25006,25534,36410,36332,36173,32768,27573,25066,23061,21553,20139,8215,19215,19099,18713,27225,26998,26772,18912,24645,24798,24243,23656,22695,18556,10998,23366,23776,27352,27125,26899,18807,24772,24747,24924,24337,23376,18427,21830,11179,23983,26747,26521,26295,18496,24880,24697,24697,24842,23881,18059,22220,22406,11174},
+        {32741,44104,43957,43850,49081,43249,43013,42998,42978,40447,29033,29177,29184,42145,32092,43017,42910,48017,42426,43109,42870,42850,40331,28781,28925,28905,42012,41126,31479,41975,46959,41609,42292,43005,42762,40238,28530,28674,28655,41916,41029,40146,30903,45906,40797,41479,42193,42903,40075,28281,28425,28405,46336,45360,44387,43417,23088,45675,46366,47268,48192,34402,19455,19367,19271,41290,40518,39750,38986,43186,21611,38193,38762,39354,26054,26110,26092,26246,41068,41167,40398,39634,43826,36467,21216,37858,38450,23908,25529,26254,26219,41052,40941,41076,40312,44660,37004,36141,20859,37552,22302,24948,25673,26407,41034,40923,40848,40987,45513,37565,36702,35845,20496,20794,24151,24875,25610,38284,38185,38106,37962,32768,24876,22874,21369,19958,7937,19030,18916,18786,27233,27007,26780,26554,18801,24439,23885,23330,22572,18389,10716,23158,23775,27360,27134,26907,26681,18696,24414,24566,24011,23254,18262,21633,10897,23982,27360,27108,26882,26656,18584,24550,24525,24702,23945,18120,22210,22396,11077},
+        {33544,44518,44189,44048,45090,50006,43793,43781,43761,43313,29856,29987,29783,42537,32867,43228,43087,44129,48941,43671,43471,43451,42986,29576,29707,29504,42232,41326,32255,42152,43194,47883,42854,43572,43329,42870,29326,29457,29253,42104,41197,40314,31679,42264,46830,42042,42759,43469,42778,29076,29208,29004,43089,42183,41300,40421,31508,47021,41495,42186,42895,42989,29117,29248,29402,47191,46214,45241,44272,44442,23521,46363,47269,48193,34401,20337,20103,19977,41822,41717,40949,40185,39669,43846,21483,38701,39293,24031,26091,26819,26726,41810,41528,41630,40866,40325,44684,36961,21125,38395,22348,25511,26238,26914,41792,41510,41403,41541,41000,45538,37521,36664,20762,21020,24713,25441,26117,40941,40649,40549,40469,40659,32768,23020,21444,20198,8801,18861,19721,19562,28012,27761,27534,27308,27346,19613,24438,23883,23126,18233,11496,23783,24342,28134,27882,27656,27430,27467,19381,25122,24568,23810,19011,22231,11709,24556,27935,27684,27458,27231,27604,19241,25028,25205,24447,18844,22754,22955,11882},
+        {33999,44617,44288,44146,45189,46090,49956,44286,44270,45430,30498,30531,30315,42634,33674,43645,43321,44364,45230,49876,44250,44234,45373,30494,30526,30310,42329,41719,33033,42366,43408,44275,48817,44134,43929,45046,30216,30248,30032,42201,41419,40517,32457,42478,43345,47764,43322,44036,44930,29966,29999,29783,43186,42405,41503,40624,32286,42965,47955,42748,43462,45138,30007,30039,30181,44061,43248,42345,41466,41106,31420,46926,42136,42849,44958,29632,29534,29617,47152,47078,46105,45136,45306,44377,24007,47267,48195,34401,20279,20986,20714,42314,42282,42181,41417,40876,40292,44705,21392,39238,22428,26102,26796,27475,42299,42268,41990,42096,41555,40971,45563,37484,21029,21046,25304,25999,26678,42920,42868,42575,42474,42661,42515,32768,21551,20255,9664,19831,19550,20365,28649,28649,28397,28171,28209,27873,19588,24463,23705,19161,11751,24341,25041,28658,28658,28406,28180,28217,27752,20192,25117,24360,18854,22780,12490,25177,28454,28454,28203,27976,28349,27830,19925,25757,25000,19592,23440,23548,12694},
+        {34519,44656,44622,44298,45340,46207,46442,50154,44989,47224,31196,31228,30913,42682,34131,43748,43423,44466,45332,46406,49836,44739,46925,31132,31165,30850,42648,41820,33842,42786,43829,44513,45552,49761,44709,46869,31129,31162,30847,42348,41520,40914,33238,42878,43562,44601,48707,44598,46543,30852,30885,30570,43334,42506,41900,41002,33067,43183,44055,48898,44025,46748,30893,30925,30968,44176,43348,42571,41672,41313,32201,43436,47869,43412,46644,30518,30420,30404,44416,44384,43575,42677,42160,41571,31541,47588,42809,46508,29657,30219,30046,47340,47048,46977,46008,46179,45249,45011,24536,48195,34401,20222,20929,21597,43003,42771,42744,42647,42105,41522,40948,45586,21295,21099,25885,26585,27232,44601,44328,44275,43982,44166,44091,43984,32768,20336,10525,20054,20519,20193,29336,29282,29282,29030,29068,28732,27913,19563,24276,19398,11840,24954,25594,29345,29291,29290,29039,29077,28611,28438,20167,24935,19781,23382,12745,25730,29028,28974,28974,28723,29095,28576,28248,20737,25546,19434,23986,24094,13474},
+        {35283,45034,44785,44756,45764,46448,46649,47125,50464,48711,32119,32153,31838,43048,34895,43911,43882,44890,45574,46613,46875,50145,48410,32055,32090,31775,42814,41986,34543,43013,44021,44705,45744,46844,49832,48112,31994,32028,31713,42785,41957,41133,34291,43996,44073,44929,45996,49762,48056,31992,32026,31711,43739,42911,42087,42063,34120,43693,44383,45422,49953,48258,32032,32067,32109,44410,43582,42758,42156,41796,33226,43743,44783,48923,47975,31630,31533,31518,44617,44586,43762,42989,42472,41863,32566,44292,48643,47891,30769,31333,31159,45083,44851,44824,44018,43477,42868,42402,31963,48572,47782,29909,30472,30986,47634,47342,47053,46987,47157,46227,45989,45944,25357,34401,20169,20877,21546,45997,45722,45449,45396,45577,45337,45280,45199,32768,11676,20080,20788,21451,30244,30190,30136,30135,30173,29812,28993,28173,19550,19464,12013,25610,26394,30254,30200,30146,30146,30184,29693,29520,28700,20156,20070,24027,12944,26551,29938,29884,29830,29830,30202,29658,29330,29181,20726,20634,24771,24898,13868},
+        {53653,56158,55868,55579,57033,57812,57678,57867,58038,61637,47907,47829,46777,53469,53361,54715,54426,55880,56659,57673,57577,57748,61348,47645,47566,46515,53201,52123,53071,53274,54728,55507,56521,57573,57458,61061,47383,47305,46253,52934,51856,50778,52783,53577,54356,55370,56422,57456,60773,47122,47044,45992,54293,53215,52137,51059,53062,53811,54591,55605,56639,61077,47399,47321,47245,55030,53952,52874,51796,51284,53025,54329,55344,56377,60143,47382,47209,46875,54907,54906,53828,52750,52021,51766,53235,55256,56289,59209,47110,47437,46971,55083,54817,54817,53739,52975,52721,52632,53482,56230,58279,46838,47165,47237,55242,54976,54710,54710,53947,53692,53603,53542,53729,57032,46417,46745,46816,58106,57844,57582,57320,57598,56734,55871,55010,53859,32768,43735,44752,45514,45483,45245,45007,44769,45023,45009,44742,44476,44071,41294,11818,37004,37304,45403,45165,44927,44689,44943,44840,45050,44783,44378,42224,35172,12101,37257,44418,44180,43942,43704,44865,44525,44611,44855,44450,42921,35465,35414,12355},
+        {32917,43727,43461,43200,44274,45144,44998,45459,46138,50206,48654,29061,28742,41195,32485,42533,42272,43346,44216,44961,45192,45871,49863,48329,28996,28677,40948,40088,32094,41349,42423,43293,44038,45160,45608,49525,48008,28932,28613,40706,39846,38990,31743,41506,42375,43121,44242,45581,49192,47690,28869,28550,41699,40839,39982,39130,31546,42603,42698,43622,44924,49399,47909,28911,28963,42505,41644,40788,39936,40140,31408,42301,43052,44326,49592,48113,28972,28963,42392,42359,41502,40650,40254,39878,30473,42400,43674,48523,47847,28542,28400,42838,42594,42564,41712,41135,40598,39982,29782,43175,48262,47812,27647,28179,43493,43248,43007,42982,42371,41809,41192,40723,28995,48205,47696,26502,27034,47263,46944,46630,46320,46505,46674,45704,45481,45455,21800,32768,17161,17867,45848,45549,45252,44956,45154,45335,45109,45095,45014,31134,7091,16949,17655,27542,27486,27431,27375,27413,27468,27103,26260,25185,16483,16434,8888,23046,27210,27155,27099,27044,27425,27424,26927,26753,25678,17090,17041,21990,9877},
+        {32227,43481,43214,42953,44027,44588,44572,44858,45513,50332,43569,48560,27894,40954,31773,42286,42025,43099,43660,44535,44591,45245,49987,43302,48235,27829,40708,39847,31363,41103,42177,42737,43612,44559,44983,49646,43040,47914,27765,40466,39606,38749,30996,41259,41820,42694,43641,44956,49310,42782,47596,27702,41459,40599,39742,38890,30785,41397,42271,43021,44298,49515,43010,47815,28114,41986,41126,40270,39417,39022,30263,41527,42276,43554,48651,43131,47731,27826,41969,41936,41080,40228,39831,39129,30156,41884,42961,48846,42538,47937,27888,42254,42009,41980,41128,40550,39847,39476,29282,42334,47778,41917,47894,27486,42886,42641,42401,42376,41764,41061,40503,39911,28467,47457,41077,47773,26341,47388,47067,46749,46436,46619,45814,45985,45016,44747,20783,48374,32768,16812,41023,40779,40538,40302,40509,40627,40069,39482,38693,45735,18651,17066,24326,45754,45455,45157,44862,45059,44984,45168,45147,45060,31134,16409,5986,16746,26412,26357,26302,26246,26627,26369,26423,26084,25009,16107,23154,16192,8728},
+        {31491,43359,43093,42832,43774,44552,44424,44643,45094,50741,43029,43082,47556,40828,31015,42165,41904,42846,43624,44387,44375,44827,50393,42761,42815,47232,40582,39721,30586,40981,41924,42702,43464,44343,44565,50050,42499,42552,46910,40340,39479,38623,30202,41006,41784,42547,43426,44538,49711,42242,42295,46592,41213,40352,39496,38644,30024,41144,41709,42588,43663,49647,42252,42305,47711,41947,41086,40230,39378,38775,29721,41025,41904,42979,48813,42434,42292,47515,41833,41800,40943,40091,39307,38662,29261,41185,42260,47950,41837,42652,47658,42032,41787,41758,40906,40121,39476,38798,29190,41671,48147,41248,42063,47867,42476,42232,41991,41966,41147,40503,39824,39271,28166,46756,40403,41218,47740,47781,47457,47137,46822,46749,45973,45170,45342,44084,20021,47668,48723,32768,40496,40251,40011,39775,39775,39951,39390,38836,38041,45067,18579,39165,17101,40538,40294,40053,39817,39817,39812,40149,39595,38801,46041,36911,18747,16995,44820,44520,44223,43928,44956,44777,44911,45097,45006,31134,16411,16287,5046},
+        {24196,48048,47771,47498,48326,49285,49127,49284,49479,49709,34415,18958,18641,45376,22683,38848,38600,39192,39671,40407,40299,40443,40649,32584,25926,25414,45120,37062,22268,37768,38360,38839,39574,40265,40195,40401,32365,25864,25353,44869,36829,36041,21895,37533,38012,38747,39438,40165,40157,30649,25803,25292,45627,37379,36591,35806,21691,37189,37950,38640,39368,40157,28503,25958,26082,46505,37820,37031,36247,35456,21372,37355,37863,38556,39346,26182,25969,25916,46365,38532,37743,36959,36194,35618,21082,37191,37884,38674,23885,26172,25931,46515,38436,38405,37621,36855,36108,35471,20596,37161,37951,21974,25423,25951,46699,38577,38346,38318,37553,36774,36137,35450,20106,36993,20440,24454,24981,46909,38769,38538,38310,38302,37523,36886,36199,35291,20052,19687,24512,25039,32768,30913,30711,29125,27128,24965,22831,21050,19620,18908,7241,18043,17650,18308,24234,24180,24126,24266,24268,24468,23761,22847,22900,17451,10116,23049,17998,23748,23694,23640,24380,24218,24241,24265,23351,23405,17075,21524,10111},
+        {32138,48622,41895,41648,42403,43140,42680,42842,42985,43191,36493,28469,27839,45934,23859,46916,46643,47471,48430,49120,49174,49368,49599,34409,19055,18738,40006,44340,22384,38129,38746,39366,39575,40497,40427,40633,32545,25940,25425,39773,44090,36398,22012,37919,38539,38748,39670,40397,40390,30725,25880,25364,40482,44847,36973,36189,21842,37741,37951,38873,39600,40390,28602,26068,26184,41174,45726,37550,36766,36000,21713,37356,38121,38814,39604,26491,26260,26208,40741,46365,37744,36959,36194,35618,21082,37191,37884,38674,23939,26206,25964,40899,46420,38631,37847,37082,36360,35472,20834,37216,38006,22268,25668,26195,41040,46604,38572,38545,37779,37025,36137,35504,20344,37048,20737,24698,25226,41232,46813,38764,38537,38528,37774,36886,36253,35345,20290,19986,24756,25284,34622,32768,30884,29203,27228,25257,22883,21323,19895,19186,7503,18365,17974,26697,18403,24259,24205,24376,24550,24499,23992,23078,23132,17749,10382,23294,26096,18093,23769,23715,24484,24501,24272,24497,23583,23636,17375,21755,10377},
+        {32349,44234,48514,41860,42615,43378,42918,42842,43041,43247,36708,28713,28080,42276,31679,47447,41037,41792,42555,43022,42749,42947,43153,36510,28461,27828,45836,44856,23568,45790,46618,47577,48268,49170,49260,49491,34405,19155,18838,39979,39207,43310,22129,38281,38926,39275,39671,40630,40622,30889,25951,25436,40688,39916,44067,36546,21959,38128,38477,38873,39832,40622,28679,26140,26256,41405,40633,44946,37148,36383,21864,37908,38122,39046,39836,26591,26367,26314,40972,41078,45586,37478,36713,36162,21423,37192,38142,38932,24249,26494,26252,40899,40821,46420,37847,37082,36360,35472,20834,37217,38007,22323,25697,26225,41094,41015,46509,38771,38005,37252,36389,35504,20582,37104,21032,24938,25466,41286,41207,46718,38763,38755,38001,37138,36253,35399,20528,20283,24997,25524,34824,34651,32768,29362,27306,25358,23176,21376,20169,19462,7766,18682,18294,26928,26702,18498,24280,24451,24657,24777,24019,23306,23359,18042,10648,23535,26324,26098,18188,23790,24559,24608,24550,24524,23810,23864,17671,21983,10643},
+        {32560,44289,44177,48407,42827,43590,43130,43080,43041,43302,38420,28953,28320,42330,31890,43237,47341,42004,42767,43259,42986,42947,43209,38327,28701,28068,42229,41342,31259,46280,41187,41950,42442,43096,42860,43121,38147,28451,27817,45738,44759,43783,23322,45767,46726,47416,48319,49258,49384,34403,19256,18939,40895,40123,39355,43287,22076,38489,38864,39400,39833,40854,28827,26208,26324,41612,40840,40071,44166,36740,21980,38295,38648,39047,40069,26668,26434,26382,41179,41309,40541,44806,37095,36545,21574,37744,38143,39164,24350,26595,26354,41131,41052,41161,45640,37601,36879,36016,21175,37217,38265,22634,25981,26508,41094,41015,40940,46509,38006,37252,36389,35504,20583,37104,21088,24964,25491,41340,41261,41186,46623,38981,38227,37364,36505,35400,20766,20579,25233,25760,36410,36332,36173,32768,27451,25437,23276,21669,20222,19736,8028,18995,18610,27156,26929,26703,18593,24523,24729,24881,24294,23329,23583,18332,10914,23771,26551,26325,26099,18283,24630,24679,24653,24799,23834,24087,17964,22206,10909},
+        {32839,44231,44084,43977,49396,43570,43144,43094,43081,43105,40581,29181,29189,42266,32169,43144,43037,48330,42747,43239,42966,42953,42977,40464,28929,28909,42133,41246,31539,42102,47269,41930,42422,43102,42866,42889,40372,28678,28659,42036,41150,40267,30947,46213,41118,41610,42289,42980,42806,40209,28429,28410,46646,45666,44690,43719,22999,45997,46687,47590,48529,49504,34402,19238,19143,41592,40820,40052,39288,43497,21843,38618,38997,39536,40031,26546,26270,26424,41192,41290,40522,39758,44137,36864,21436,38093,38631,39127,24174,26431,26396,41144,41033,41167,40403,44971,37223,36360,21071,37732,38227,22482,25850,26585,41132,41021,40946,41059,45839,37733,36870,36011,20669,37066,21145,25015,25749,41147,41036,40961,40890,46734,38189,37326,36467,35362,20512,20381,25026,25760,38407,38307,38229,38084,32768,25333,23123,21538,20283,19557,8011,19049,18919,27364,27138,26911,26685,18578,24580,24732,24177,23384,23386,18385,10897,23982,27364,27112,26886,26660,18465,24716,24691,24868,24075,24077,18243,22396,11078},
+        {32917,44343,44014,43873,44837,50245,43173,43130,43117,43167,42918,29207,29003,42362,32219,43053,42912,43876,49178,43051,42820,42806,42856,42590,28927,28724,42057,41150,31589,41977,42941,48117,42234,42921,42684,42734,42474,28677,28473,41928,41022,40139,30997,42011,47061,41422,42108,42825,42651,42382,28428,28224,42847,41940,41058,40179,30489,46266,40846,41532,42248,43027,42492,28221,28375,47425,46445,45470,44498,43763,22635,46049,46744,47650,48625,34401,19133,19007,41211,41106,40338,39574,39029,43547,21193,38233,38805,39466,23984,26064,25998,41170,40888,40990,40226,39682,44190,36502,20828,37905,38566,22294,25483,26159,41158,40876,40769,40907,40363,45028,37044,36184,20460,37431,20961,24681,25358,41198,40916,40809,40737,41096,45922,37662,36803,35723,20526,20200,24908,25584,40570,40278,40177,40098,40202,32768,22950,21367,20115,19391,7750,18880,18721,27381,27129,26903,26677,26488,18483,24386,23831,23070,23276,18231,10632,23729,27182,26931,26705,26478,26625,18343,24316,24468,23707,23913,18064,22158,10804},
+        {33369,44439,44110,43968,44933,45751,50186,43635,43626,43675,45203,29751,29535,42456,33023,43467,43144,44074,44892,50103,43599,43590,43640,45146,29746,29530,42152,41542,32365,42188,43118,43937,49042,43483,43285,43335,44819,29468,29252,42023,41242,40339,31773,42188,43007,47986,42671,43391,43218,44703,29219,29003,42941,42128,41226,40347,31265,42313,47191,42095,42815,43594,44867,29012,29154,43718,42905,42002,41124,40465,31135,47366,41535,42228,43007,45060,29070,29153,47377,47300,46324,45352,44618,44774,23097,46742,47651,48627,34401,20016,19744,41673,41642,41541,40777,40232,39704,44211,21094,38748,39409,22379,26041,26720,41665,41634,41356,41462,40918,40364,45053,37004,20726,38274,20995,25239,25919,41705,41674,41395,41292,41650,41097,45947,37622,36542,20793,20426,25466,26145,42704,42652,42359,42259,42412,42585,32768,21478,20179,19632,8614,18709,19525,27905,27905,27653,27427,27238,27292,19294,24381,23619,23825,18074,11412,24350,27701,27701,27450,27223,27370,27370,19027,25021,24259,24465,18812,22752,11617},
+        {33886,44475,44440,44116,45047,45865,45932,50376,44345,44398,47104,30448,30133,42501,33477,43566,43242,44172,44991,45896,50054,44095,44148,46806,30385,30070,42467,41639,33171,42605,43353,44171,45042,49977,44065,44118,46749,30382,30067,42167,41339,40733,32551,42402,43220,44091,48920,43954,43818,46423,30105,29790,43053,42225,41448,40549,32043,42526,43397,48125,43377,44160,46563,29898,29941,43830,43002,42225,41326,40667,31914,43005,48301,42791,43574,46754,29956,29941,43912,43880,43071,42172,41514,41142,31074,47273,42183,42966,46613,29582,29435,47557,47262,47189,46217,45482,45638,44710,23614,47649,48628,34401,19959,20627,42369,42137,42110,42013,41468,40915,40335,45074,20993,39117,21052,25826,26473,42412,42181,42153,41879,42205,41652,41072,45972,37362,21059,20440,26053,26699,44485,44212,44159,43866,43997,44168,44057,32768,20265,19678,9477,19678,19352,28592,28538,28537,28286,28098,28151,27816,19269,24195,24401,19001,11667,24903,28275,28221,28221,27970,28116,28116,27651,19839,24805,25011,18654,23297,12397},
+        {34648,44814,44566,44536,45250,46068,46101,46554,50586,45329,48627,31373,31058,42831,34239,43691,43662,44375,45194,46065,46304,50265,45079,48326,31310,30995,42597,41769,33869,42793,43506,44325,45196,46273,49949,44835,48028,31248,30933,42568,41740,40916,33601,42874,43693,44381,45424,49876,44809,47972,31246,30931,43251,42423,41599,40997,33065,42978,43666,44709,49080,44934,47902,31012,31055,44028,43200,42376,41774,41095,32936,43274,44150,49256,44348,48090,31070,31054,44077,44046,43222,42449,41770,41398,32096,43536,48228,43740,47999,30696,30549,44521,44290,44262,43457,42778,42250,41664,31465,47949,43141,47884,29835,30349,47757,47462,47171,47101,46367,46523,45594,45357,24429,48610,34401,19903,20572,43322,43091,42863,42840,42963,42409,41830,41259,45985,21464,20521,26842,27494,45915,45640,45366,45313,45252,45420,45356,45270,32768,19793,10634,19948,20610,29501,29447,29393,29393,29179,29233,28898,28078,19254,25174,19290,11867,25724,29185,29131,29077,29077,29198,29198,28733,28559,19824,25790,19854,24102,12790},
+        {34437,44759,44511,44267,45276,46094,45944,46362,46981,50691,49384,31167,30852,42777,34028,43636,43393,44401,45220,45908,46113,46731,50369,49080,31103,30788,42544,41716,33659,42524,43532,44351,45039,46082,46486,50053,48779,31041,30726,42314,41487,40662,33328,42668,43487,44175,45218,46461,49742,48481,30981,30666,43268,42440,41616,40796,33144,43697,43779,44639,45848,49930,48681,31021,31064,44045,43217,42393,41573,41769,33014,43386,44080,45262,50105,48867,31079,31064,43923,43892,43068,42248,41866,41494,32147,43445,44627,49077,48582,30678,30531,44335,44103,44076,43256,42702,42174,41569,31515,44139,48798,48512,29817,30331,44941,44709,44482,44458,43873,43319,42714,42252,30797,48697,48357,28715,29229,47852,47557,47266,46979,47146,47302,46374,46137,46071,24241,34401,19800,20468,46627,46349,46073,45799,45978,46144,45903,45857,45742,32768,10372,19749,20417,29305,29251,29197,29143,29181,29234,28874,28054,27008,19159,19110,11602,25513,28989,28935,28881,28827,29199,29199,28709,28535,27489,19729,19679,23902,12525},
+        {53639,56162,55872,55583,56749,57898,57529,57681,57852,58139,61839,47844,46792,53473,53347,54719,54430,55596,56745,57524,57390,57561,57848,61550,47582,46530,53205,52127,53057,53278,54444,55593,56372,57387,57272,57558,61262,47320,46268,52938,51860,50782,52768,53293,54442,55221,56236,57269,57270,60975,47059,46007,54032,52954,51876,50798,52773,53597,54376,55391,56424,57573,60993,47077,47001,55109,54031,52953,51875,51079,53034,53813,54593,55589,56738,61278,47335,47001,54768,54768,53690,52611,51816,51287,52998,54332,55328,56477,60344,47318,46889,54910,54644,54644,53566,52770,52024,51769,53208,55240,56389,59411,47046,47118,55069,54803,54538,54537,53741,52961,52706,52618,53455,56209,58158,46626,46697,55334,55068,54803,54537,54819,54039,53784,53695,53522,53717,58444,46884,46956,58294,58032,57769,57507,57524,57785,56921,56058,54901,55163,32768,44915,45677,45418,45180,44941,44703,44720,44957,44943,44676,44271,44509,42376,11839,37196,44432,44194,43956,43718,44642,44642,44538,44748,44343,44580,43073,35357,12093},
+        {31997,43420,43154,42892,43736,44606,44589,44678,45295,45526,50445,49186,27663,40896,31544,42226,41965,42808,43678,44552,44411,45028,45259,50100,48859,27598,40650,39790,31133,41042,41885,42755,43629,44379,44766,44997,49759,48535,27534,40408,39548,38691,30766,40968,41838,42712,43461,44739,44739,49423,48214,27471,41190,40330,39473,38621,30489,41174,42048,42798,44075,44967,49370,48173,27823,41995,41135,40279,39427,38807,30339,42262,42361,43404,44295,49560,48373,27823,41978,41945,41089,40236,39617,39808,30231,41968,42810,43701,49755,48576,27883,42081,41836,41807,40955,40336,39926,39555,29329,42162,43053,48687,48310,27454,42680,42435,42194,42169,41550,40925,40367,39754,28514,42350,48366,48250,26309,42891,42646,42405,42169,42377,41752,41194,40581,39925,28531,48586,48469,26370,47492,47170,46853,46540,46486,46655,46826,45857,45587,45786,20620,32768,16700,46350,46047,45747,45449,45407,45587,45768,45541,45511,45710,31134,5701,16532,26199,26143,26088,26032,26358,26358,26412,26048,24972,25027,16003,15996,8441},
+        {31261,43299,43032,42771,43483,44570,44244,44463,44877,45108,50854,43021,48192,40770,30785,42105,41843,42555,43642,44207,44195,44610,44840,50506,42754,47865,40524,39663,30356,40921,41633,42719,43285,44163,44347,44578,50163,42491,47541,40282,39421,38565,29972,40715,41802,42367,43246,44320,44321,49824,42234,47220,40944,40083,39227,38375,29728,40921,41486,42365,43440,44331,49502,42014,48078,41956,41095,40239,39387,38561,29797,41110,41989,42829,43720,49722,42288,48166,41660,41627,40771,39919,39092,38742,29309,41248,42088,42980,48859,42414,48082,41859,41614,41585,40733,39907,39556,38857,29238,41499,42390,49056,41824,48287,42270,42025,41784,41759,40933,40366,39668,39114,28214,41539,47665,40979,48219,42481,42236,41996,41759,41760,41193,40494,39941,39141,28231,47880,41209,48434,47885,47561,47241,46925,46616,46814,46010,46183,44925,45118,19858,48835,32768,40480,40235,39995,39759,39548,39800,39922,39368,38574,38785,46145,18488,16781,45425,45123,44822,44524,45313,45389,45314,45497,45460,45653,31134,16091,4760},
+        {24080,48359,48082,47810,48637,49357,49472,49422,49582,49813,50047,34415,18404,45677,22541,38876,38629,39220,39486,40495,40205,40315,40521,40731,32584,25204,45422,37088,22105,37797,38388,38653,39663,40171,40066,40272,40482,32365,25142,45170,36855,36067,21715,37561,37826,38836,39344,40037,40029,40239,30650,25081,45928,37405,36616,35832,21495,37003,38039,38546,39239,40029,40026,28503,25871,46589,37645,36857,36072,35282,21127,37232,37740,38433,39223,40016,26047,25647,46692,38608,37820,37036,36270,35496,21178,37407,37883,38673,39467,24241,25916,46651,38342,38310,37526,36761,35987,35666,20684,37160,37950,38744,22172,25908,46804,38450,38219,38191,37426,36652,36128,35441,20189,36990,37783,20557,24939,47014,38642,38411,38183,38175,37401,36877,36190,35281,20132,37993,19781,24997,47227,38838,38607,38379,38171,38154,37630,36943,36034,36230,20117,19185,25055,32768,30913,30711,29125,27128,24842,23155,21229,19724,18991,18423,7079,17546,17780,23548,23494,23440,24180,23965,24218,24218,23304,23358,23411,16980,9846},
+        {32023,48957,41923,41676,42431,42954,42769,42748,42857,43063,43273,36493,27629,46259,23720,47227,46955,47782,48502,49466,49311,49472,49702,49937,34409,18501,40031,44641,22222,38158,38775,39180,39664,40403,40299,40505,40715,32546,25214,39798,44391,36424,21832,37948,38353,38837,39576,40269,40261,40471,30726,25153,40508,45148,36999,36214,21646,37556,38039,38778,39472,40262,40258,28603,25973,40999,45809,37376,36591,35826,21468,37233,37998,38691,39481,40275,26356,25938,40817,46692,37820,37036,36271,35497,21179,37407,37883,38673,39467,24295,25949,40804,46556,38537,37752,36987,36238,35666,20922,37215,38005,38799,22466,26153,40913,46709,38445,38418,37652,36904,36128,35495,20427,37045,37839,20854,25183,41105,46918,38637,38410,38401,37653,36877,36244,35335,20370,38049,20080,25241,41301,47132,38833,38606,38397,38406,37630,36997,36088,36284,20355,19488,25300,34622,32768,30884,29203,27228,25135,23207,21502,19999,19269,18704,7341,17870,25897,17875,23569,23515,24284,24247,24250,24449,23535,23589,23642,17280,10112},
+        {32234,44262,48849,41888,42643,43192,43007,42748,42912,43118,43328,36708,27869,42301,31543,47780,41065,41820,42369,43110,42655,42819,43025,43235,36510,27617,46161,45178,23408,46102,46929,47649,48613,49307,49363,49594,49828,34405,18601,40005,39233,43611,21948,38309,38740,39363,39577,40501,40494,40704,30890,25225,40714,39942,44368,36571,21763,37942,38566,38779,39704,40494,40490,28679,26045,41231,40459,45029,36974,36208,21619,37785,37998,38923,39713,40507,26457,26044,41049,41155,45912,37555,36790,36041,21519,37408,38141,38931,39725,24605,26237,40805,40726,46556,37752,36987,36238,35667,20922,37216,38005,38799,22521,26182,40967,40888,46614,38644,37879,37130,36380,35495,20665,37100,37894,21149,25423,41159,41080,46823,38636,38628,37879,37129,36245,35389,20608,38104,20378,25482,41355,41276,47037,38832,38624,38632,37882,36998,36142,36338,20594,19788,25540,34824,34651,32768,29362,27306,25235,23500,21555,20272,19544,18982,7603,18190,26124,25898,17971,23590,24359,24354,24528,24477,23763,23816,23870,17576,10378},
+        {32445,44317,44205,48742,42855,43404,43218,42986,42913,43174,43384,38421,28109,42355,31754,43265,47673,42032,42581,43348,42892,42819,43080,43290,38328,27857,42254,41367,31106,46610,41215,41764,42531,43002,42731,42993,43203,38147,27607,46063,45081,44103,23144,46078,46798,47761,48456,49361,49487,49722,34403,18702,40920,40148,39380,43589,21880,38303,38953,39306,39705,40726,40722,28827,26113,41437,40665,39897,44249,36565,21735,38172,38525,38924,39945,40739,26534,26112,41256,41386,40618,45132,37172,36423,21670,37960,38142,39164,39957,24706,26339,41036,40957,41067,45776,37506,36757,36211,21263,37216,38264,39057,22832,26466,40967,40888,40813,46614,37879,37130,36380,35496,20666,37101,37894,21204,25449,41213,41134,41059,46728,38854,38105,37355,36496,35389,20846,38160,20673,25718,41409,41330,41255,46942,38850,38858,38108,37249,36142,36392,20832,20086,25776,36410,36332,36173,32768,27451,25314,23601,21848,20326,19818,19259,7866,18506,26352,26125,25899,18066,24431,24425,24631,24751,23786,24040,24093,17869,10644},
+        {32724,44259,44112,44005,49732,43384,43233,43000,42953,42977,43242,40582,28978,42291,32034,43172,43065,48663,42561,43328,42872,42825,42849,43114,40465,28699,42158,41272,31385,42130,47599,41744,42511,43008,42737,42761,43026,40372,28448,42062,41175,40292,30778,46540,40932,41699,42195,42852,42678,42943,40209,28199,46970,45988,45010,44035,22806,46069,47033,47727,48632,49607,49738,34402,18906,41418,40646,39878,39113,43580,21598,38495,38874,39412,39908,40933,26411,26155,41268,41367,40599,39834,44463,36742,21533,38309,38631,39126,40152,24530,26381,41049,40938,41073,40308,45107,37102,36555,21159,37731,38226,39252,22680,26542,41005,40894,40819,40932,45945,37611,36861,36002,20751,37063,38114,21262,25707,41020,40909,40834,40763,46839,38068,37318,36458,35351,20592,38122,20476,25718,41269,41159,41084,41012,46957,39047,38297,37437,36356,36354,20815,20128,25987,38407,38307,38229,38084,32768,25210,23448,21717,20387,19639,19300,7849,18816,27164,26913,26686,26460,18248,24463,24669,24821,24027,24030,24283,18148,10813},
+        {33013,44426,44097,43956,44921,50476,43450,43217,43170,43220,43247,43051,29003,42441,32295,43136,42995,43959,49407,43329,42907,42860,42909,42937,42724,28724,42136,41230,31646,42060,43024,48343,42511,43008,42737,42787,42815,42608,28473,42008,41101,40219,31039,42095,47284,41699,42196,42878,42704,42732,42516,28224,42926,42020,41137,40258,30518,46486,41123,41619,42301,43055,42885,42626,28375,47654,46672,45694,44720,43982,22531,46287,46982,47887,48862,49841,34401,18874,41472,41367,40599,39835,39290,43778,21412,38615,38962,39598,40097,24408,26171,41253,40970,41073,40309,39764,44422,36858,21038,38062,38698,39197,22521,26333,41209,40927,40820,40958,40414,45260,37190,36330,20665,37560,38060,21127,25531,41249,40966,40859,40788,41121,46154,37783,36924,35842,20695,38067,20551,25723,41267,40985,40878,40806,40955,47052,38243,37384,36302,36301,20578,19948,25735,40693,40400,40300,40221,40325,32768,23345,21580,20272,19717,19137,7850,18855,27183,26931,26705,26479,26625,18221,24478,24630,23869,24043,24045,18187,10805},
+        {32739,44220,43891,43750,44714,45455,50341,42971,42931,42981,43034,44858,28750,42240,32373,43249,42925,43855,44596,50256,42936,42895,42945,42999,44801,28746,41935,41326,31696,41969,42899,43640,49192,42819,42590,42640,42694,44474,28468,41807,41026,40123,31089,41969,42710,48133,42007,42697,42523,42577,44359,28218,42725,41912,41010,40131,30568,42016,47335,41431,42120,42899,42730,44522,28369,43434,42621,41719,40840,40181,30104,46524,40842,41531,42310,43093,44632,28122,47531,47452,46474,45499,44762,44013,22198,46344,47008,47983,48962,34401,18770,41021,40990,40889,40124,39580,39024,43832,20795,38210,38871,39536,22332,25961,40984,40953,40674,40781,40236,39680,44449,36479,20421,37734,38399,20941,25159,41024,40993,40714,40611,40969,40413,45343,37097,36015,20485,38432,20367,25386,41067,41036,40758,40654,40803,41149,46241,37719,36637,36661,20592,19767,25613,42380,42328,42035,41934,42087,42190,32768,21407,20101,19549,18972,7588,18684,26944,26944,26693,26467,26613,26387,18125,24280,23519,23725,23931,18033,10540},
+        {33254,44253,44219,43895,44825,45566,45550,50521,43650,43704,43757,46917,29349,42282,32825,43345,43020,43951,44691,45514,50197,43401,43454,43507,46618,29286,42248,41420,32500,42384,43131,43838,44660,50117,43370,43424,43477,46562,29283,41948,41120,40514,31865,42181,42887,43710,49058,43259,43124,43177,46236,29006,42835,42007,41229,40331,31344,42193,43016,48260,42683,43466,43296,46376,29157,43544,42716,41907,41008,40349,30880,42309,47449,42094,42877,43659,46522,28909,43528,43497,42687,41789,41130,40459,30779,47626,41512,42294,43077,46715,28967,47702,47404,47329,46354,45617,44868,45025,22694,47006,47985,48964,34401,19653,41687,41456,41429,41331,40787,40231,39681,44469,20688,38577,39242,21003,25713,41731,41500,41472,41198,41524,40967,40418,45368,36835,20752,39275,20388,25940,41774,41543,41516,41241,41358,41704,41154,46266,37457,37481,20859,19994,26167,44306,44033,43980,43687,43818,43955,44128,32768,20192,19602,19214,8452,18511,27518,27464,27464,27213,27359,27133,27187,18937,24065,24271,24476,17874,11320},
+        {34013,44589,44341,44311,45025,45731,45716,46000,50723,44635,44692,48521,30274,42609,33583,43466,43437,44150,44857,45679,45750,50399,44385,44442,48220,30211,42375,41547,33196,42568,43281,43988,44810,45719,50080,44140,44198,47922,30149,42346,41518,40694,32912,42649,43173,43996,44871,50005,44115,44172,47866,30147,43029,42201,41377,40775,32364,42458,43281,44156,49207,44240,44108,47795,30270,43706,42878,42054,41281,40602,31900,42574,43449,48396,43651,44437,47918,30023,43690,43659,42835,42061,41383,40712,31799,43061,48573,43069,43855,48109,30081,43976,43744,43717,42912,42233,41562,41194,30991,47547,42464,43251,47989,29707,47894,47596,47302,47230,46493,45744,45901,44974,23499,47964,48948,34401,19598,42641,42409,42182,42159,42281,41725,41175,40600,45379,21157,40350,20475,26734,42688,42457,42229,42206,42151,42465,41916,41340,46281,38527,21264,20024,26961,45811,45536,45263,45209,45148,45263,45434,45343,32768,19723,19282,9611,19769,28428,28374,28320,28320,28441,28215,28268,27933,18922,25049,25255,19074,11713},
+        {33803,44534,44286,44042,45051,45574,45559,45809,46404,50828,44637,49300,30067,42555,33373,43411,43168,44176,44700,45522,45559,46154,50503,44387,48996,30004,42322,41493,32985,42299,43307,43831,44653,45528,45910,50185,44143,48695,29942,42092,41264,40440,32639,42443,42967,43789,44664,45884,49871,43903,48398,29882,43046,42218,41394,40574,32442,42571,43393,44086,45271,50056,44114,48598,30280,43552,42724,41900,41080,40698,31950,42666,43358,44544,49245,44226,48510,30005,43536,43505,42681,41860,41478,40788,31849,42970,43962,49422,43644,48697,30063,43790,43558,43531,42711,42157,41467,41099,31041,43351,48396,43040,48619,29689,44374,44143,43915,43892,43306,42615,42066,41484,30296,48052,42224,48459,28587,47989,47691,47398,47108,47273,46524,46681,45754,45465,23311,49052,34401,19494,42635,42403,42176,41952,42149,42259,41710,41134,40361,46376,21026,19825,26750,46544,46266,45991,45717,45896,45818,45986,45933,45812,32768,19102,9350,19576,28232,28178,28124,28070,28443,28191,28245,27909,26863,18827,25055,18899,11448},
+        {33592,44479,44231,43987,44782,45600,45585,45652,46213,46427,50932,49897,29857,42502,33163,43356,43113,43907,44726,45548,45402,45963,46177,50608,49591,29793,42268,41440,32775,42244,43038,43857,44679,45371,45719,45932,50289,49288,29731,42039,41211,40387,32428,42174,42993,43815,44507,45693,45693,49975,48987,29671,42793,41965,41141,40320,32168,42365,43187,43879,45065,45903,49921,48946,30010,43569,42741,41917,41097,40497,32028,43385,43471,44439,45278,50094,49128,30010,43553,43522,42698,41878,41278,41462,31927,43082,43857,44696,50271,49313,30068,43635,43404,43377,42557,41956,41562,41194,31092,43226,44065,49244,49028,29667,44188,43956,43729,43705,43105,42508,41958,41357,30347,43381,48900,48925,28565,44388,44156,43929,43705,43902,43304,42755,42153,41508,30363,49101,49126,28624,48084,47786,47493,47203,47150,47304,47461,46534,46245,46425,23159,34401,19390,47112,46831,46553,46276,46235,46398,46563,46321,46253,46433,32768,9088,19383,28032,27978,27924,27870,28189,28189,28242,27882,26835,26889,18731,18724,11183},
+        {53616,56157,55868,55579,56745,57607,57607,57524,57657,57944,58231,62014,46759,53469,53324,54715,54426,55592,56454,57602,57233,57367,57653,57940,61725,46497,53202,52124,53034,53274,54440,55302,56450,57230,57077,57364,57650,61437,46235,52935,51857,50778,52745,53289,54150,55299,56079,57074,57075,57362,61150,45974,54028,52950,51872,50794,52751,53306,54455,55234,56230,57379,57379,61168,46968,54840,53762,52684,51605,50810,52738,53591,54371,55367,56516,57665,61167,46709,54839,54839,53761,52683,51887,51074,52999,53808,54531,55681,56830,61452,46967,54764,54498,54498,53420,52624,51811,51283,52963,54270,55419,56568,60518,46951,54889,54623,54357,54357,53561,52748,51968,51713,53173,55211,56360,59263,46530,55154,54888,54622,54356,54638,53826,53045,52790,52591,53434,56647,59549,46788,55419,55153,54887,54621,54638,54903,54123,53868,53668,53933,53696,59834,47047,58456,58194,57932,57669,57686,57685,57947,57083,55924,56185,56447,32768,45796,44401,44163,43925,43687,44611,44373,44610,44595,44191,44428,44665,43183,11832},
+        {31031,43238,42972,42710,43422,44279,44262,44480,44660,44890,45121,50968,48549,40712,30555,42044,41783,42495,43351,44225,44213,44392,44623,44854,50619,48219,40466,39605,30126,40860,41572,42428,43302,44181,44130,44361,44592,50276,47893,40224,39363,38507,29742,40654,41511,42385,43263,44103,44104,44334,49937,47569,40886,40025,39169,38317,29498,40630,41504,42382,43222,44114,44114,49615,48425,41687,40826,39970,39118,38292,29501,40887,41766,42606,43497,44388,49577,48252,41670,41636,40780,39928,39102,38527,29385,41983,41938,42829,43721,49769,48452,41868,41623,41594,40742,39916,39341,39536,29313,41349,42240,43131,49965,48654,42063,41818,41578,41553,40726,40152,39531,38978,28261,41367,42258,48574,48325,42274,42029,41789,41552,41553,40979,40358,39805,38984,28278,42489,48789,48540,42486,42241,42000,41764,41553,41806,41185,40632,39811,40022,28339,49003,48754,47989,47665,47345,47029,46719,46680,46851,47024,45766,45959,46152,19739,32768,45773,45468,45165,44864,45650,45487,45666,45846,45570,45762,45955,31134,4475},
+        {24880,49648,49375,49102,48955,49885,49761,49984,49902,50133,50367,50605,34415,46906,22708,39515,39268,39685,40257,41053,41038,40930,41136,41346,41560,32631,46654,37708,22251,38436,38857,39429,40225,41007,40685,40891,41101,41315,32420,46403,37475,36687,21843,38030,38602,39398,40180,40656,40648,40858,41072,30710,46236,37858,37074,36289,21921,37021,37982,38764,39241,40030,40027,40241,29238,47095,38398,37613,36829,35298,21823,37379,38161,38637,39427,40221,40221,26878,46980,39161,38377,37592,36223,35647,21828,37616,38093,38882,39676,40474,24937,47182,39145,39118,38334,36964,36389,35870,21677,37492,38282,39076,39873,23291,47114,39050,38823,38796,37426,36851,36332,35758,21177,37321,38115,38913,21564,47324,39243,39015,38788,38175,37600,37081,36507,35597,21117,38325,39123,20715,47537,39439,39211,38984,38171,38353,37834,37260,36350,36546,21103,39336,20110,47755,39638,39411,39183,38371,38352,38591,38017,37107,37303,37503,21134,19762,32768,30983,30788,29208,27806,25615,23805,22265,20655,19855,19278,18937,7934},
+        {32410,50259,42701,42454,43036,43608,43209,43462,43354,43560,43770,43984,36392,47500,24507,48520,48247,48100,49030,49755,49873,49792,50022,50257,50495,34409,40786,45874,22368,38797,39383,39956,40225,41239,40918,41124,41334,41548,32595,40553,45623,37044,21959,38556,39129,39398,40412,40888,40881,41091,41304,30778,41098,45457,37593,36808,22261,37713,37983,39023,39499,40288,40285,40499,29545,41637,46315,38132,37348,35978,22164,37380,38419,38895,39685,40479,40479,27188,41256,46980,38377,37592,36223,35647,21829,37617,38093,38883,39676,40474,24991,41494,47087,39344,38560,37215,36640,35870,21916,37547,38337,39131,39929,23585,41399,47019,39049,39022,37678,37102,36332,35812,21415,37376,38170,38968,21860,41591,47229,39241,39014,38427,37851,37081,36561,35651,21355,38380,39178,21015,41787,47442,39437,39210,38423,38604,37834,37314,36404,36600,21341,39392,20412,41987,47660,39637,39410,38622,38604,38591,38071,37161,37357,37557,21372,20067,34552,32768,30957,29279,28096,25907,23857,22537,20930,20133,19559,19220,8196},
+        {32621,45172,50151,42666,43273,43846,43446,43462,43410,43616,43826,44040,36599,43184,31910,49089,41843,42454,43027,43554,43373,43320,43526,43736,43950,36406,47402,46426,24180,47394,47248,48177,48902,49869,49684,49914,50148,50387,34405,40759,39987,44843,22076,38943,39515,39925,40413,41120,41113,41323,41537,30937,41329,40561,44677,37191,22412,38126,38535,39023,39731,40521,40517,40731,29655,41869,41101,45536,37730,36386,22315,37932,38420,39127,39917,40711,40711,27288,41487,41597,46200,38111,36767,36192,22169,37617,38351,39141,39935,40732,25301,41494,41419,47087,38560,37216,36640,35870,21916,37547,38337,39131,39929,23640,41453,41378,46924,39248,37904,37328,36583,35812,21653,37432,38226,39023,22155,41645,41570,47134,39240,38653,38077,37332,36561,35705,21593,38436,39233,21312,41841,41766,47347,39436,38649,38830,38085,37314,36458,36654,21579,39447,20713,42041,41966,47564,39636,38849,38830,38842,38071,37215,37411,37611,21610,20370,34747,34578,32768,29433,28206,26007,24150,22590,21203,20409,19837,19501,8459},
+        {32832,45227,45115,50045,43485,44058,43658,43700,43410,43671,43881,44095,38307,43238,32121,44175,48982,42666,43239,43792,43611,43320,43582,43792,44006,38221,43137,42250,31454,47921,41849,42422,42975,43720,43233,43494,43704,43918,38046,47305,46329,45353,23897,46396,47326,48051,49018,49681,49807,50042,50280,34403,41536,40768,40000,43897,22529,38487,38922,39550,39732,40753,40749,40963,29803,42075,41307,40539,44756,36743,22432,38319,38946,39128,40150,40943,40944,27365,41694,41828,41060,45421,37149,36574,22320,38170,38351,39373,40167,40965,25402,41725,41650,41760,46307,37735,37159,36414,22257,37548,38595,39389,40187,23950,41453,41378,41303,46924,37904,37329,36584,35812,21653,37432,38226,39024,22211,41699,41624,41549,47039,38879,38304,37559,36812,35705,21831,38491,39289,21607,41895,41820,41745,47252,38875,39057,38312,37565,36458,36708,21817,39503,21011,42095,42020,41945,47469,39075,39056,39068,38322,37215,37465,37665,21848,20671,36327,36256,36102,32768,28350,26087,24251,22884,21257,20683,20114,19780,8721},
+        {32435,44214,44075,43968,50075,43453,43060,43102,42837,42861,43126,43340,39848,42251,31697,43114,43007,49003,42610,43163,42981,42717,42741,43006,43220,39524,42125,41218,31030,42072,47937,41792,42345,43116,42629,42653,42918,43132,39398,42028,41122,40239,30407,46875,40980,41533,42304,42744,42570,42835,43049,39235,47303,46318,45337,44360,22611,46388,47112,48079,48743,49718,49848,50086,34402,41482,40691,39922,39158,43889,21387,38299,38952,39274,39769,40795,40795,26412,41106,41211,40443,39679,44554,36558,21275,38176,38497,38993,40018,40816,24395,41138,41034,41168,40404,45440,37168,36423,21246,37720,38215,39241,40038,22967,40890,40786,40711,40825,46057,37475,36730,35983,20832,37052,38103,38901,21438,40905,40801,40726,40655,46951,37931,37186,36440,35333,20670,38110,38908,20579,41155,41051,40976,40905,47070,38910,38165,37419,36337,36336,20893,39177,20222,41355,41251,41176,41104,47287,38910,38922,38176,37094,37092,37346,20924,19885,37729,37439,37329,37185,32768,25210,23325,21980,20545,19731,19383,19052,7712},
+        {32846,44567,44238,44097,44939,51056,43445,43487,43223,43272,43300,43569,42211,42582,32107,43277,43136,43978,49984,43324,43177,42912,42962,42990,43259,41883,42278,41371,31441,42201,43043,48917,42507,43278,42790,42840,42868,43137,41767,42149,41243,40360,30818,42113,47856,41694,42465,42930,42757,42785,43054,41675,42942,42036,41153,40274,30334,46818,40927,41698,42163,42916,42746,43015,42626,48210,47226,46245,45268,44304,22558,46396,47363,48027,49002,49981,50115,34401,41474,41369,40601,39837,39106,43897,21392,38537,38884,39519,40019,41048,24377,41506,41224,41326,40562,39831,44783,36780,21362,38106,38742,39241,40271,22912,41259,40976,40869,41008,40277,45400,37112,36366,20983,37604,38104,39133,21406,41298,41016,40909,40838,40985,46294,37705,36959,35877,21010,38111,39166,20758,41317,41034,40927,40856,40819,47192,38165,37419,36337,36336,20893,39177,20146,41570,41288,41181,41110,41072,47314,39148,38402,37320,37344,37346,21162,20048,39920,39628,39528,39448,40325,32768,23317,21938,20525,19903,19315,19205,7842},
+        {32783,44416,44087,43946,44788,45719,50817,43430,43165,43215,43269,43300,44150,42435,32396,43445,43121,43929,44860,50729,43394,43130,43179,43233,43264,44093,42130,41520,31702,42165,42973,43904,49662,43278,42825,42874,42928,42959,43767,42002,41221,40318,31079,42043,42975,48601,42466,42931,42757,42811,42842,43651,42795,41982,41079,40200,30595,42089,47563,41698,42163,42942,42772,42804,44656,43690,42877,41975,41096,40251,30331,46778,41164,41629,42408,43165,42999,44662,47992,47910,46929,45952,44988,44264,22317,46618,47282,48257,49236,50219,34401,41459,41427,41326,40562,39831,39329,44099,21242,38412,39073,39713,40216,22774,41211,41180,40902,41008,40277,39774,44715,36669,20862,37936,38575,39079,21249,41251,41220,40941,40838,41010,40507,45610,37287,36205,20924,38608,39112,20624,41294,41263,40985,40882,40844,41219,46508,37884,36802,36826,20997,39123,20221,41317,41285,41007,40904,40866,41057,47410,38348,37267,37290,37293,20925,19869,41730,41678,41385,41284,42210,42218,32768,21820,20389,19789,19393,19042,7842},
+        {32573,44147,44113,43789,44597,45528,45435,50921,43141,43190,43244,43301,45799,42181,32122,43238,42914,43722,44654,45399,50594,42891,42941,42994,43051,45500,42148,41320,31780,42277,42903,43800,44545,50511,42861,42910,42964,43021,45444,41848,41020,40414,31129,41952,42849,43594,49449,42750,42610,42664,42721,45118,42609,41781,41003,40105,30645,41964,42709,48411,41982,42761,42591,42649,46099,43504,42676,41867,40968,40123,30382,42057,47627,41448,42227,43010,42844,46141,43421,43390,42580,41682,40837,40219,29949,46818,40863,41642,42425,43212,46268,48087,47787,47709,46732,45768,45044,44296,22020,46403,47378,48357,49340,34401,41187,40955,40928,40831,40100,39597,39045,43904,20619,38084,38749,39417,21060,41226,40995,40968,40693,40833,40330,39778,44798,36354,20680,38782,39451,20438,41270,41038,41011,40736,40667,41067,40514,45696,36976,37000,20787,39487,20038,41317,41086,41058,40784,40714,40905,41255,46598,37602,37626,37653,20940,19689,43270,42998,42945,42651,43555,43597,43715,32768,20217,19619,19226,18878,7581},
+        {33329,44446,44198,44168,44793,45691,45597,45800,51113,44121,44179,44236,47515,42474,32879,43323,43294,43919,44816,45561,45550,50787,43871,43929,43986,47213,42240,41412,32473,42425,43050,43947,44692,45519,50465,43627,43684,43741,46915,42211,41383,40559,32174,42418,43133,43844,44670,50387,43602,43659,43716,46859,42800,41972,41148,40546,31662,42227,42937,43764,49349,43535,43404,43461,47630,43664,42836,42012,41239,40373,31399,42286,43113,48565,43001,43788,43622,47649,43581,43549,42725,41920,41055,40438,30966,42410,47755,42416,43203,43990,47795,43769,43537,43510,42705,41840,41222,40555,30899,47934,41838,42625,43412,47987,48270,47970,47673,47599,46635,45911,45163,45322,22807,47358,48341,49324,34401,42136,41905,41677,41654,41590,41088,40535,39989,44809,21085,39857,40526,20529,42184,41952,41725,41701,41460,41828,41276,40730,45711,38046,21192,40563,20075,42231,42000,41772,41749,41508,41666,42016,41470,46613,38672,38700,21344,19965,44880,44605,44332,44278,44990,45010,45146,45318,32768,19745,19302,19174,8740},
+        {33118,44391,44143,43899,44819,45534,45406,45608,46008,51218,44124,44181,48366,42420,32668,43268,43025,43945,44659,45370,45359,45758,50891,43874,43931,48062,42186,41358,32262,42156,43076,43790,44501,45328,45514,50569,43629,43687,47761,41957,41129,40305,31900,42212,42926,43637,44464,45488,50253,43390,43447,47463,42818,41990,41166,40345,31740,42339,42867,43694,44684,50198,43409,43466,48504,43510,42682,41858,41038,40469,31449,42195,43022,44012,49413,43576,43445,48313,43394,43363,42539,41719,40979,40342,31017,42319,43309,48604,42992,43778,48435,43583,43351,43324,42504,41764,41127,40460,30950,42731,48783,42413,43200,48625,43984,43752,43525,43502,42730,42093,41426,40880,30004,47450,41592,42379,48459,48365,48065,47769,47476,47415,46691,45943,46101,44901,22614,48445,49428,34401,42130,41899,41671,41448,41458,41622,41070,40524,39745,45806,20955,40508,19882,42177,41946,41719,41495,41505,41492,41810,41264,40486,46708,38646,21107,19773,45680,45402,45126,44852,45804,45632,45746,45916,45790,32768,19126,18999,8479},
+        {32908,44336,44088,43845,44550,45560,45249,45452,45817,46031,51322,44126,48973,42367,32458,43213,42970,43676,44685,45213,45202,45567,45781,50995,43876,48666,42133,41305,32052,42101,42807,43816,44344,45171,45323,45537,50673,43632,48363,41904,41076,40252,31690,41943,42952,43480,44307,45297,45297,50357,43392,48062,42564,41736,40912,40092,31467,42133,42661,43488,44478,45316,50063,43197,48862,43527,42699,41875,41055,40268,31527,42307,43134,43908,44746,50263,43450,48940,43240,43209,42385,41565,40778,40438,31067,42411,43184,44023,49453,43567,48852,43428,43197,43170,42350,41563,41223,40536,31000,42606,43445,49631,42989,49039,43798,43566,43339,43315,42529,41985,41298,40752,30055,42617,48299,42168,48928,43998,43766,43539,43315,43325,42781,42095,41549,40764,30070,48494,42381,49124,48460,48160,47864,47571,47292,47471,46723,46881,45681,45856,22462,49532,34401,42124,41893,41665,41442,41252,41490,41604,41059,40280,40480,46804,20870,19580,46257,45976,45698,45421,46152,46220,46142,46309,46233,46409,32768,18824,8217},
+        {32698,44281,44033,43790,44495,45291,45275,45478,45626,45840,46054,51426,49323,42313,32247,43158,42915,43621,44416,45239,45228,45376,45590,45804,51099,49013,42079,41251,31841,42046,42752,43547,44370,45197,45132,45346,45560,50778,48707,41850,41022,40198,31479,41888,42683,43506,44333,45106,45106,45320,50461,48404,42511,41683,40859,40038,31256,41864,42687,43514,44287,45125,45125,50168,49201,43274,42446,41622,40801,40015,31253,42101,42928,43701,44540,45378,50128,49038,43258,43226,42402,41582,40796,40237,31145,43130,43080,43918,44757,50303,49220,43446,43214,43187,42367,41580,41022,41210,31078,42502,43340,44179,50481,49404,43611,43380,43153,43129,42343,41784,41190,40645,30105,42492,43331,49148,49053,43811,43580,43353,43129,43139,42580,41987,41441,40637,30121,43545,49343,49248,44011,43780,43552,43329,43139,43377,42783,42238,41433,41633,30178,49539,49444,48555,48255,47959,47666,47387,47348,47502,47661,46461,46636,46811,22352,34401,46598,46315,46034,45755,46483,46330,46493,46657,46361,46536,46711,32768,7956},
+        {53881,57156,56866,56577,56741,57802,57515,57801,57662,57949,58235,58522,61089,54402,53589,55713,55424,55588,56649,57510,57511,57371,57658,57945,58231,60800,54135,53056,53299,54272,54436,55497,56358,57507,57082,57368,57655,57942,60512,53868,52790,51711,53010,53285,54346,55207,56356,57079,57080,57366,57653,60225,54025,52947,51869,50790,52728,53301,54163,55312,56035,57184,57184,57471,61316,55022,53943,52865,51787,50806,52743,53309,54458,55181,56330,57479,57480,61175,54756,54755,53677,52599,51618,50814,52731,53595,54318,55467,56616,57765,61174,55020,54755,54754,53676,52695,51891,51078,52992,53483,54632,55781,56930,61460,54894,54628,54362,54361,53381,52576,51764,50983,52919,54222,55372,56521,60204,55159,54893,54627,54361,54458,53653,52841,52061,51667,53180,55658,56807,60489,55424,55158,54892,54626,54457,54731,53918,53138,52745,53010,53442,57094,60775,55689,55423,55157,54891,54722,54730,54995,54215,53822,54087,54352,53703,61060,57601,57339,57076,56814,57823,57693,57693,57954,56795,57056,57318,57579,32768}
+    };
+
+    inline constexpr std::uint16_t VS_RANDOM[169] = {
+        32986,21170,21757,22468,22331,22664,24135,25623,27307,29064,30995,33101,35997,
+        23582,35188,23033,23766,23643,23987,24565,26227,27914,29671,31601,33702,36598,
+        24136,25324,37370,25005,24910,25264,25851,26654,28510,30268,32196,34293,37178,
+        24805,26013,27166,39534,26177,26550,27150,27963,29000,30920,32846,34939,37811,
+        24686,25908,27088,28267,41474,27736,28338,29157,30206,31355,33439,35535,37802,
+        25005,26238,27426,28623,29734,43408,29524,30341,31397,32559,33925,36167,38562,
+        26392,26786,27985,29193,30306,31415,45326,31520,32585,33744,35127,36713,39238,
+        27797,28353,28745,29964,31082,32189,33292,47223,33771,34898,36280,37887,39827,
+        29386,29945,30494,30943,32073,33186,34297,35407,49159,36207,37546,39150,41105,
+        31049,31609,32158,32759,33165,34291,35399,36478,37701,50770,38099,39694,41656,
+        32878,33435,33983,34582,35135,35587,36711,37790,38972,39491,52379,40275,42225,
+        34872,35425,35969,36564,37120,37707,38215,39313,40493,41004,41549,53998,42808,
+        37603,38155,38688,39270,39259,39966,40595,41144,42337,42855,43390,43938,55838
+    };
+}
+
+#endif
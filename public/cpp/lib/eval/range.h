@@ -0,0 +1,191 @@
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "../game/card.h"
+#include "hole_combos.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace RangeMasks {
+    // Padded so that every row is a whole number of 8-float vectors.
+    constexpr int PADDED_COMBOS = 1328;
+
+    // For each card, all-ones for combos that do not contain it and zero for
+    // the 51 combos that do. ANDing a range with a row removes that card.
+    struct alignas(32) BlockerTable {
+        std::array<std::array<std::uint32_t, PADDED_COMBOS>, Card::NUM_CARDS> masks;
+    };
+
+    constexpr BlockerTable buildBlockerTable() {
+        BlockerTable table{};
+        for (int card = 0; card < Card::NUM_CARDS; card++) {
+            for (int combo = 0; combo < HoleCombos::NUM_COMBOS; combo++) {
+                bool blocked = HoleCombos::firstCard(combo).getIndex() == card ||
+                               HoleCombos::secondCard(combo).getIndex() == card;
+                table.masks[card][combo] = blocked ? 0u : 0xFFFFFFFFu;
+            }
+        }
+        return table;
+    }
+
+    inline constexpr BlockerTable BLOCKERS = buildBlockerTable();
+}
+
+// Weights over the 1326 hole combos, indexed by HoleCombos. Storage is a
+// 32-byte aligned float array padded with zeros, and the bulk operations use
+// AVX when it is enabled at compile time.
+class Range {
+private:
+    static constexpr int PADDED = RangeMasks::PADDED_COMBOS;
+    alignas(32) std::array<float, PADDED> weights;
+
+public:
+    Range() : weights() {}
+
+    static Range uniform() {
+        Range range;
+        for (int i = 0; i < HoleCombos::NUM_COMBOS; i++) {
+            range.weights[i] = 1.0f;
+        }
+        return range;
+    }
+
+    float operator[](int combo) const {
+        return weights[combo];
+    }
+
+    float& operator[](int combo) {
+        return weights[combo];
+    }
+
+    float get(const Hand& hand) const {
+        return weights[HoleCombos::indexOf(hand)];
+    }
+
+    void set(const Hand& hand, float weight) {
+        weights[HoleCombos::indexOf(hand)] = weight;
+    }
+
+    // Plain copy of the 1326 weights, in the ComboWeights layout used by the
+    // equity calculators.
+    std::vector<float> toVector() const {
+        return std::vector<float>(weights.begin(), weights.begin() + HoleCombos::NUM_COMBOS);
+    }
+
+    const float* data() const {
+        return weights.data();
+    }
+
+    float* data() {
+        return weights.data();
+    }
+
+    float sum() const {
+#if defined(__AVX__)
+        __m256 acc = _mm256_setzero_ps();
+        for (int i = 0; i < PADDED; i += 8) {
+            acc = _mm256_add_ps(acc, _mm256_load_ps(weights.data() + i));
+        }
+        return horizontalSum(acc);
+#else
+        float total = 0.0f;
+        for (int i = 0; i < PADDED; i++) {
+            total += weights[i];
+        }
+        return total;
+#endif
+    }
+
+    void scale(float factor) {
+#if defined(__AVX__)
+        const __m256 f = _mm256_set1_ps(factor);
+        for (int i = 0; i < PADDED; i += 8) {
+            _mm256_store_ps(weights.data() + i, _mm256_mul_ps(_mm256_load_ps(weights.data() + i), f));
+        }
+#else
+        for (int i = 0; i < PADDED; i++) {
+            weights[i] *= factor;
+        }
+#endif
+    }
+
+    // Rescales to sum to one; returns false and leaves the range untouched
+    // when it is empty.
+    bool normalize() {
+        float total = sum();
+        if (total <= 0.0f) {
+            return false;
+        }
+        scale(1.0f / total);
+        return true;
+    }
+
+    // Element-wise product, e.g. applying per-combo action probabilities.
+    void multiply(const Range& other) {
+#if defined(__AVX__)
+        for (int i = 0; i < PADDED; i += 8) {
+            __m256 product = _mm256_mul_ps(_mm256_load_ps(weights.data() + i), _mm256_load_ps(other.weights.data() + i));
+            _mm256_store_ps(weights.data() + i, product);
+        }
+#else
+        for (int i = 0; i < PADDED; i++) {
+            weights[i] *= other.weights[i];
+        }
+#endif
+    }
+
+    float dot(const Range& other) const {
+#if defined(__AVX__)
+        __m256 acc = _mm256_setzero_ps();
+        for (int i = 0; i < PADDED; i += 8) {
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_load_ps(weights.data() + i),
+                                                   _mm256_load_ps(other.weights.data() + i)));
+        }
+        return horizontalSum(acc);
+#else
+        float total = 0.0f;
+        for (int i = 0; i < PADDED; i++) {
+            total += weights[i] * other.weights[i];
+        }
+        return total;
+#endif
+    }
+
+    // Zeroes every combo that shares a card with dead.
+    void removeBlocked(CardSet dead) {
+        while (!dead.empty()) {
+            const std::uint32_t* mask = RangeMasks::BLOCKERS.masks[dead.pop().getIndex()].data();
+#if defined(__AVX__)
+            for (int i = 0; i < PADDED; i += 8) {
+                __m256 keep = _mm256_loadu_ps(reinterpret_cast<const float*>(mask + i));
+                _mm256_store_ps(weights.data() + i, _mm256_and_ps(_mm256_load_ps(weights.data() + i), keep));
+            }
+#else
+            for (int i = 0; i < PADDED; i++) {
+                std::uint32_t bits;
+                std::memcpy(&bits, &weights[i], sizeof(bits));
+                bits &= mask[i];
+                std::memcpy(&weights[i], &bits, sizeof(bits));
+            }
+#endif
+        }
+    }
+
+private:
+#if defined(__AVX__)
+    static float horizontalSum(__m256 v) {
+        __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        __m128 sum2 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+        __m128 sum1 = _mm_add_ss(sum2, _mm_shuffle_ps(sum2, sum2, 1));
+        return _mm_cvtss_f32(sum1);
+    }
+#endif
+};
+
+#endif
@@ -0,0 +1,333 @@
+#ifndef CARD_H
+#define CARD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace CardBits {
+    inline int popcount(std::uint64_t bits) {
+#ifdef _MSC_VER
+        return static_cast<int>(__popcnt64(bits));
+#else
+        return __builtin_popcountll(bits);
+#endif
+    }
+
+    inline int lowestBit(std::uint64_t bits) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(bits);
+#endif
+    }
+}
+
+// A card packed into one byte as rank * 4 + suit, with ranks 0..12 for 2..A
+// and suits 0..3 for s, h, d, c. 255 marks an unset card.
+class Card {
+private:
+    std::uint8_t value;
+
+public:
+    static constexpr int NUM_RANKS = 13;
+    static constexpr int NUM_SUITS = 4;
+    static constexpr int NUM_CARDS = 52;
+    static constexpr std::uint8_t NONE = 0xFF;
+
+    constexpr Card() : value(NONE) {}
+    constexpr Card(int rank, int suit) : value(static_cast<std::uint8_t>(rank * NUM_SUITS + suit)) {}
+
+    static constexpr Card fromIndex(int index) {
+        return Card(index / NUM_SUITS, index % NUM_SUITS);
+    }
+
+    static constexpr int rankFromChar(char c) {
+        switch (c) {
+            case '2': return 0;
+            case '3': return 1;
+            case '4': return 2;
+            case '5': return 3;
+            case '6': return 4;
+            case '7': return 5;
+            case '8': return 6;
+            case '9': return 7;
+            case 'T': case 't': return 8;
+            case 'J': case 'j': return 9;
+            case 'Q': case 'q': return 10;
+            case 'K': case 'k': return 11;
+            case 'A': case 'a': return 12;
+            default: return -1;
+        }
+    }
+
+    static constexpr int suitFromChar(char c) {
+        switch (c) {
+            case 's': case 'S': return 0;
+            case 'h': case 'H': return 1;
+            case 'd': case 'D': return 2;
+            case 'c': case 'C': return 3;
+            default: return -1;
+        }
+    }
+
+    static constexpr char rankToChar(int rank) {
+        return "23456789TJQKA"[rank];
+    }
+
+    static constexpr char suitToChar(int suit) {
+        return "shdc"[suit];
+    }
+
+    static Card parse(std::string_view text) {
+        int rank = text.size() == 2 ? rankFromChar(text[0]) : -1;
+        int suit = text.size() == 2 ? suitFromChar(text[1]) : -1;
+        if (rank < 0 || suit < 0) {
+            throw std::invalid_argument("Invalid card: " + std::string(text));
+        }
+        return Card(rank, suit);
+    }
+
+    constexpr bool isValid() const {
+        return value != NONE;
+    }
+
+    constexpr int getIndex() const {
+        return value;
+    }
+
+    constexpr int getRank() const {
+        return value / NUM_SUITS;
+    }
+
+    constexpr int getSuit() const {
+        return value % NUM_SUITS;
+    }
+
+    // Bit position inside a CardSet; each suit owns a 16-bit lane so that
+    // suit masks fall out of a single shift.
+    constexpr int getBit() const {
+        return getSuit() * 16 + getRank();
+    }
+
+    constexpr bool operator==(Card other) const {
+        return value == other.value;
+    }
+
+    constexpr bool operator!=(Card other) const {
+        return value != other.value;
+    }
+
+    std::string toString() const {
+        if (!isValid()) {
+            return "??";
+        }
+        return std::string{rankToChar(getRank()), suitToChar(getSuit())};
+    }
+};
+
+class CardSet {
+private:
+    std::uint64_t bits;
+
+public:
+    static constexpr std::uint64_t RANK_MASK = 0x1FFF;
+
+    constexpr CardSet() : bits(0) {}
+    constexpr explicit CardSet(std::uint64_t bits) : bits(bits) {}
+    constexpr CardSet(Card card) : bits(std::uint64_t{1} << card.getBit()) {}
+
+    static constexpr CardSet fullDeck() {
+        return CardSet(RANK_MASK | (RANK_MASK << 16) | (RANK_MASK << 32) | (RANK_MASK << 48));
+    }
+
+    constexpr std::uint64_t getBits() const {
+        return bits;
+    }
+
+    constexpr bool empty() const {
+        return bits == 0;
+    }
+
+    int size() const {
+        return CardBits::popcount(bits);
+    }
+
+    constexpr bool contains(Card card) const {
+        return (bits >> card.getBit()) & 1;
+    }
+
+    constexpr bool intersects(CardSet other) const {
+        return (bits & other.bits) != 0;
+    }
+
+    constexpr void add(Card card) {
+        bits |= std::uint64_t{1} << card.getBit();
+    }
+
+    constexpr void remove(Card card) {
+        bits &= ~(std::uint64_t{1} << card.getBit());
+    }
+
+    constexpr unsigned suitMask(int suit) const {
+        return static_cast<unsigned>((bits >> (suit * 16)) & RANK_MASK);
+    }
+
+    constexpr unsigned rankMask() const {
+        return suitMask(0) | suitMask(1) | suitMask(2) | suitMask(3);
+    }
+
+    constexpr bool containsRank(int rank) const {
+        return (rankMask() >> rank) & 1;
+    }
+
+    // Removes and returns the lowest card; the set must not be empty.
+    Card pop() {
+        int bit = CardBits::lowestBit(bits);
+        bits &= bits - 1;
+        return Card(bit % 16, bit / 16);
+    }
+
+    constexpr CardSet operator|(CardSet other) const {
+        return CardSet(bits | other.bits);
+    }
+
+    constexpr CardSet operator&(CardSet other) const {
+        return CardSet(bits & other.bits);
+    }
+
+    constexpr CardSet operator~() const {
+        return CardSet(~bits & fullDeck().bits);
+    }
+
+    constexpr CardSet& operator|=(CardSet other) {
+        bits |= other.bits;
+        return *this;
+    }
+
+    constexpr CardSet& operator&=(CardSet other) {
+        bits &= other.bits;
+        return *this;
+    }
+
+    constexpr bool operator==(CardSet other) const {
+        return bits == other.bits;
+    }
+
+    constexpr bool operator!=(CardSet other) const {
+        return bits != other.bits;
+    }
+
+    std::string toString() const {
+        std::string result;
+        CardSet rest = *this;
+        while (!rest.empty()) {
+            if (!result.empty()) {
+                result += ',';
+            }
+            result += rest.pop().toString();
+        }
+        return result;
+    }
+};
+
+// Ordered, fixed-capacity list of cards stored inline, so copying a hand or
+// board never touches the heap.
+template <std::size_t Capacity>
+class CardList {
+private:
+    std::array<Card, Capacity> cards;
+    std::uint8_t count;
+
+public:
+    constexpr CardList() : cards(), count(0) {}
+
+    static CardList parse(std::string_view text) {
+        CardList result;
+        while (!text.empty()) {
+            std::size_t comma = text.find(',');
+            std::string_view token = text.substr(0, comma);
+            if (!token.empty()) {
+                result.push_back(Card::parse(token));
+            }
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            text.remove_prefix(comma + 1);
+        }
+        return result;
+    }
+
+    void push_back(Card card) {
+        if (count == Capacity) {
+            throw std::length_error("CardList capacity exceeded");
+        }
+        cards[count++] = card;
+    }
+
+    constexpr void clear() {
+        count = 0;
+    }
+
+    constexpr std::size_t size() const {
+        return count;
+    }
+
+    constexpr bool empty() const {
+        return count == 0;
+    }
+
+    constexpr Card operator[](std::size_t index) const {
+        return cards[index];
+    }
+
+    constexpr const Card* begin() const {
+        return cards.data();
+    }
+
+    constexpr const Card* end() const {
+        return cards.data() + count;
+    }
+
+    constexpr CardSet getMask() const {
+        CardSet mask;
+        for (std::size_t i = 0; i < count; i++) {
+            mask.add(cards[i]);
+        }
+        return mask;
+    }
+
+    // Mask of the first n cards, e.g. the visible part of a board.
+    constexpr CardSet getMask(std::size_t n) const {
+        CardSet mask;
+        for (std::size_t i = 0; i < n && i < count; i++) {
+            mask.add(cards[i]);
+        }
+        return mask;
+    }
+
+    std::string toString() const {
+        std::string result;
+        for (std::size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                result += ',';
+            }
+            result += cards[i].toString();
+        }
+        return result;
+    }
+};
+
+using Hand = CardList<2>;
+using Board = CardList<5>;
+
+#endif
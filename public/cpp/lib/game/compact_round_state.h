@@ -0,0 +1,346 @@
+#ifndef COMPACT_ROUND_STATE_H
+#define COMPACT_ROUND_STATE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "../eval/hand_evaluator.h"
+#include "card.h"
+#include "game_constants.h"
+#include "legal_actions.h"
+#include "poker_moves.h"
+#include "round_state.h"
+#include "terminal_state.h"
+
+// Flat, trivially copyable counterpart of RoundState for solvers and
+// rollouts. It follows the same betting rules, but proceed() returns a new
+// value instead of allocating and linking a history node; callers that need
+// the history keep an ActionLog alongside. The full board is stored so that
+// rollouts can run to showdown, and only the first getStreet() cards are
+// treated as visible.
+class CompactRoundState {
+public:
+    enum class Status : std::uint8_t {
+        ACTIVE,
+        FOLDED,
+        SHOWDOWN
+    };
+
+private:
+    std::array<std::int16_t, 2> pips;
+    std::array<std::int16_t, 2> stacks;
+    // Counts actions on the street, which can exceed 127 in a long raise
+    // chain (see ActionLog).
+    std::int16_t button;
+    std::int8_t street;
+    std::array<std::int8_t, 2> bountyRanks;
+    std::array<Card, 4> holeCards;
+    std::array<Card, 5> board;
+    Status status;
+    std::int8_t folder;
+
+    void proceedStreet() {
+        if (street == 5) {
+            status = Status::SHOWDOWN;
+            return;
+        }
+        street = static_cast<std::int8_t>(street == 0 ? 3 : street + 1);
+        button = 1;
+        pips = {0, 0};
+    }
+
+public:
+    // Start of a hand with blinds posted. bountyRanks are 0..12, or -1 for
+    // no bounty.
+    static CompactRoundState deal(const std::array<Hand, 2>& hands, const Board& fullBoard,
+                                  const std::array<int, 2>& bountyRanks) {
+        CompactRoundState state{};
+        state.pips = {GameConstants::SMALL_BLIND, GameConstants::BIG_BLIND};
+        state.stacks = {GameConstants::STARTING_STACK - GameConstants::SMALL_BLIND,
+                        GameConstants::STARTING_STACK - GameConstants::BIG_BLIND};
+        state.button = 0;
+        state.street = 0;
+        state.bountyRanks = {static_cast<std::int8_t>(bountyRanks[0]), static_cast<std::int8_t>(bountyRanks[1])};
+        for (int player = 0; player < 2; player++) {
+            for (std::size_t i = 0; i < 2; i++) {
+                state.holeCards[player * 2 + i] = i < hands[player].size() ? hands[player][i] : Card();
+            }
+        }
+        for (std::size_t i = 0; i < 5; i++) {
+            state.board[i] = i < fullBoard.size() ? fullBoard[i] : Card();
+        }
+        state.status = Status::ACTIVE;
+        state.folder = -1;
+        return state;
+    }
+
+    static CompactRoundState fromRoundState(const RoundState& roundState) {
+        std::array<int, 2> bountyRanks;
+        for (int player = 0; player < 2; player++) {
+            const std::string& bounty = roundState.getBounties()[player];
+            bountyRanks[player] = bounty.empty() ? -1 : Card::rankFromChar(bounty[0]);
+        }
+        CompactRoundState state = deal(roundState.getHands(), roundState.getDeck(), bountyRanks);
+        for (int player = 0; player < 2; player++) {
+            state.pips[player] = static_cast<std::int16_t>(roundState.getPips()[player]);
+            state.stacks[player] = static_cast<std::int16_t>(roundState.getStacks()[player]);
+        }
+        state.button = static_cast<std::int16_t>(roundState.getButton());
+        state.street = static_cast<std::int8_t>(roundState.getStreet());
+        return state;
+    }
+
+    // Heap-allocated RoundState with the same position and visible cards,
+    // for code that still expects the linked representation.
+    std::shared_ptr<RoundState> toRoundState() const {
+        std::array<std::string, 2> bounties;
+        for (int player = 0; player < 2; player++) {
+            bounties[player] = bountyRanks[player] < 0 ? "-1" : std::string(1, Card::rankToChar(bountyRanks[player]));
+        }
+        return std::make_shared<RoundState>(button, street, getPips(), getStacks(),
+                                            std::array<Hand, 2>{getHand(0), getHand(1)}, bounties, getBoard(),
+                                            nullptr);
+    }
+
+    int getButton() const {
+        return button;
+    }
+
+    int getStreet() const {
+        return street;
+    }
+
+    int getActive() const {
+        return button % 2;
+    }
+
+    Status getStatus() const {
+        return status;
+    }
+
+    bool isTerminal() const {
+        return status != Status::ACTIVE;
+    }
+
+    std::array<int, 2> getPips() const {
+        return {pips[0], pips[1]};
+    }
+
+    std::array<int, 2> getStacks() const {
+        return {stacks[0], stacks[1]};
+    }
+
+    int getBountyRank(int player) const {
+        return bountyRanks[player];
+    }
+
+    Hand getHand(int player) const {
+        Hand hand;
+        for (int i = 0; i < 2; i++) {
+            if (holeCards[player * 2 + i].isValid()) {
+                hand.push_back(holeCards[player * 2 + i]);
+            }
+        }
+        return hand;
+    }
+
+    CardSet getHandMask(int player) const {
+        CardSet mask;
+        for (int i = 0; i < 2; i++) {
+            if (holeCards[player * 2 + i].isValid()) {
+                mask.add(holeCards[player * 2 + i]);
+            }
+        }
+        return mask;
+    }
+
+    // Visible board for the current street.
+    Board getBoard() const {
+        Board visible;
+        for (int i = 0; i < street && board[i].isValid(); i++) {
+            visible.push_back(board[i]);
+        }
+        return visible;
+    }
+
+    CardSet getBoardMask() const {
+        CardSet mask;
+        for (int i = 0; i < street && board[i].isValid(); i++) {
+            mask.add(board[i]);
+        }
+        return mask;
+    }
+
+    int getContinueCost() const {
+        int active = getActive();
+        return pips[1 - active] - pips[active];
+    }
+
+    ActionOptions getActionOptions() const {
+        return ActionOptions::compute(getActive(), getPips(), getStacks());
+    }
+
+    std::array<bool, 2> getBountyHits() const {
+        std::array<bool, 2> hits = {false, false};
+        CardSet visible = getBoardMask();
+        for (int player = 0; player < 2; player++) {
+            hits[player] = bountyRanks[player] >= 0 && (getHandMask(player) | visible).containsRank(bountyRanks[player]);
+        }
+        return hits;
+    }
+
+    // Chip deltas of a finished hand, before bounties. Showdowns compare
+    // both hands on the full stored board.
+    std::array<int, 2> getDeltas() const {
+        if (status == Status::FOLDED) {
+            int lost = GameConstants::STARTING_STACK - stacks[folder];
+            return folder == 0 ? std::array<int, 2>{-lost, lost} : std::array<int, 2>{lost, -lost};
+        }
+        if (status == Status::SHOWDOWN) {
+            CardSet fullBoard;
+            for (Card card : board) {
+                if (card.isValid()) {
+                    fullBoard.add(card);
+                }
+            }
+            HandEvaluator::HandRank rank0 = HandEvaluator::evaluate(getHandMask(0) | fullBoard);
+            HandEvaluator::HandRank rank1 = HandEvaluator::evaluate(getHandMask(1) | fullBoard);
+            if (rank0 == rank1) {
+                return {0, 0};
+            }
+            int winner = rank0 > rank1 ? 0 : 1;
+            int won = GameConstants::STARTING_STACK - stacks[1 - winner];
+            return winner == 0 ? std::array<int, 2>{won, -won} : std::array<int, 2>{-won, won};
+        }
+        return {0, 0};
+    }
+
+    // Deltas with the bounty rules applied.
+    std::array<int, 2> getPayoffs() const {
+        return TerminalState::applyBounties(getDeltas(), getBountyHits());
+    }
+
+    CompactRoundState proceed(Move action) const {
+        CompactRoundState next = *this;
+        const int active = getActive();
+        const int amount = action.getAmount();
+
+        switch (action.getType()) {
+            case PokerMove::Type::FOLD:
+                next.status = Status::FOLDED;
+                next.folder = static_cast<std::int8_t>(active);
+                return next;
+
+            case PokerMove::Type::CALL: {
+                if (button == 0) {
+                    next.button = 1;
+                    next.pips = {GameConstants::BIG_BLIND, GameConstants::BIG_BLIND};
+                    next.stacks = {GameConstants::STARTING_STACK - GameConstants::BIG_BLIND,
+                                   GameConstants::STARTING_STACK - GameConstants::BIG_BLIND};
+                    return next;
+                }
+                int contribution = pips[1 - active] - pips[active];
+                next.stacks[active] = static_cast<std::int16_t>(stacks[active] - contribution);
+                next.pips[active] = static_cast<std::int16_t>(pips[active] + contribution);
+                next.proceedStreet();
+                return next;
+            }
+
+            case PokerMove::Type::CHECK:
+                if ((street == 0 && button > 0) || button > 1) {
+                    next.proceedStreet();
+                } else {
+                    next.button++;
+                }
+                return next;
+
+            case PokerMove::Type::RAISE: {
+                int contribution = amount - pips[active];
+                next.stacks[active] = static_cast<std::int16_t>(stacks[active] - contribution);
+                next.pips[active] = static_cast<std::int16_t>(amount);
+                next.button++;
+                return next;
+            }
+        }
+
+        throw std::invalid_argument("Unknown action type");
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<CompactRoundState>, "CompactRoundState must stay trivially copyable");
+static_assert(sizeof(CompactRoundState) <= 32, "CompactRoundState should fit in half a cache line");
+
+// One entry of a hand's betting history.
+struct ActionRecord {
+    Move move;
+    std::int8_t street;
+    std::int8_t player;
+};
+
+// Fixed-capacity betting history for one hand, replacing the previousState
+// chain. A raise must add at least max(continueCost, BIG_BLIND) over the
+// opponent's pip, so each raise on a street lifts the bet by at least
+// BIG_BLIND and a street holds at most STARTING_STACK / BIG_BLIND raises.
+// Besides raises a street has at most two other actions: a check or
+// preflop limp before the first raise, and the call, check or fold that
+// closes it. The capacity covers that on all four streets.
+class ActionLog {
+public:
+    static constexpr std::size_t MAX_RAISES_PER_STREET = GameConstants::STARTING_STACK / GameConstants::BIG_BLIND;
+    static constexpr std::size_t MAX_ACTIONS_PER_STREET = MAX_RAISES_PER_STREET + 2;
+    static constexpr std::size_t CAPACITY = 4 * MAX_ACTIONS_PER_STREET;
+
+private:
+    std::array<ActionRecord, CAPACITY> records;
+    std::size_t count;
+
+public:
+    ActionLog() : records(), count(0) {}
+
+    void push_back(const ActionRecord& record) {
+        if (count == CAPACITY) {
+            throw std::length_error("ActionLog capacity exceeded");
+        }
+        records[count++] = record;
+    }
+
+    // Records the action taken in state and returns the resulting state.
+    CompactRoundState apply(const CompactRoundState& state, Move move) {
+        push_back({move, static_cast<std::int8_t>(state.getStreet()), static_cast<std::int8_t>(state.getActive())});
+        return state.proceed(move);
+    }
+
+    void clear() {
+        count = 0;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    const ActionRecord& operator[](std::size_t index) const {
+        return records[index];
+    }
+
+    const ActionRecord* begin() const {
+        return records.data();
+    }
+
+    const ActionRecord* end() const {
+        return records.data() + count;
+    }
+};
+
+static_assert(ActionOptions::compute(1, {0, 0}, {GameConstants::STARTING_STACK, GameConstants::STARTING_STACK})
+                      .raiseBounds[0] == GameConstants::BIG_BLIND,
+              "ActionLog::CAPACITY assumes the smallest raise is one big blind");
+
+#endif
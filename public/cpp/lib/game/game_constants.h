@@ -6,6 +6,14 @@ namespace GameConstants {
     constexpr int STARTING_STACK = 400;
     constexpr int BIG_BLIND = 2;
     constexpr int SMALL_BLIND = 1;
+
+    // Placeholder bounty rules, to be confirmed against the game spec. The
+    // engine only reports bounty ranks and hits; private/game.py settles
+    // no bounty payouts, so these values are assumptions rather than rules
+    // taken from it.
+    constexpr int ROUNDS_PER_BOUNTY = 25;
+    constexpr double BOUNTY_RATIO = 1.5;
+    constexpr int BOUNTY_CONSTANT = 10;
 }
 
 #endif
@@ -0,0 +1,103 @@
+#ifndef LEGAL_ACTIONS_H
+#define LEGAL_ACTIONS_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <unordered_set>
+#include "game_constants.h"
+#include "poker_moves.h"
+
+// Set of PokerMove types as a bitmask, one bit per type.
+class LegalActions {
+private:
+    std::uint8_t bits;
+
+    static constexpr std::uint8_t bitOf(PokerMove::Type type) {
+        return static_cast<std::uint8_t>(1u << static_cast<int>(type));
+    }
+
+public:
+    constexpr LegalActions() : bits(0) {}
+    constexpr explicit LegalActions(std::uint8_t bits) : bits(bits) {}
+
+    constexpr std::uint8_t getBits() const {
+        return bits;
+    }
+
+    constexpr bool contains(PokerMove::Type type) const {
+        return (bits & bitOf(type)) != 0;
+    }
+
+    constexpr void add(PokerMove::Type type) {
+        bits = static_cast<std::uint8_t>(bits | bitOf(type));
+    }
+
+    constexpr void remove(PokerMove::Type type) {
+        bits = static_cast<std::uint8_t>(bits & ~bitOf(type));
+    }
+
+    constexpr bool empty() const {
+        return bits == 0;
+    }
+
+    constexpr int size() const {
+        int count = 0;
+        for (std::uint8_t rest = bits; rest; rest = static_cast<std::uint8_t>(rest & (rest - 1))) {
+            count++;
+        }
+        return count;
+    }
+
+    constexpr bool operator==(LegalActions other) const {
+        return bits == other.bits;
+    }
+
+    constexpr bool operator!=(LegalActions other) const {
+        return bits != other.bits;
+    }
+
+    std::unordered_set<PokerMove::Type> toSet() const {
+        std::unordered_set<PokerMove::Type> types;
+        for (PokerMove::Type type : {PokerMove::Type::FOLD, PokerMove::Type::CALL, PokerMove::Type::CHECK,
+                                     PokerMove::Type::RAISE}) {
+            if (contains(type)) {
+                types.insert(type);
+            }
+        }
+        return types;
+    }
+};
+
+// Legal actions together with the raise-to bounds, which are only
+// meaningful when RAISE is legal.
+struct ActionOptions {
+    LegalActions legal;
+    std::array<int, 2> raiseBounds;
+
+    // Shared by every state representation so they cannot drift apart.
+    static constexpr ActionOptions compute(int active, const std::array<int, 2>& pips, const std::array<int, 2>& stacks) {
+        ActionOptions options{};
+        int continueCost = pips[1 - active] - pips[active];
+        bool canRaise = false;
+        if (continueCost == 0) {
+            options.legal.add(PokerMove::Type::CHECK);
+            options.legal.add(PokerMove::Type::FOLD);
+            canRaise = stacks[0] != 0 && stacks[1] != 0;
+        } else {
+            options.legal.add(PokerMove::Type::FOLD);
+            options.legal.add(PokerMove::Type::CALL);
+            canRaise = continueCost != stacks[active] && stacks[1 - active] != 0;
+        }
+        if (canRaise) {
+            options.legal.add(PokerMove::Type::RAISE);
+        }
+
+        int maxContribution = std::min(stacks[active], stacks[1 - active] + continueCost);
+        int minContribution = std::min(maxContribution, continueCost + std::max(continueCost, GameConstants::BIG_BLIND));
+        options.raiseBounds = {pips[active] + minContribution, pips[active] + maxContribution};
+        return options;
+    }
+};
+
+#endif
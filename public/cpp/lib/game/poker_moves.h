@@ -1,8 +1,14 @@
 #ifndef POKER_MOVES_H
 #define POKER_MOVES_H
 
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <type_traits>
 
 class PokerMove {
 public:
@@ -72,4 +78,119 @@ public:
     }
 };
 
+// Four-byte value type for a move, so moves can be returned by value and
+// stored contiguously in logs and search trees. Converts implicitly from the
+// PokerMove classes above.
+class Move {
+private:
+    std::uint8_t type;
+    std::int16_t amount;
+
+public:
+    constexpr Move() : type(static_cast<std::uint8_t>(PokerMove::Type::FOLD)), amount(0) {}
+    constexpr Move(PokerMove::Type type, int amount = 0)
+        : type(static_cast<std::uint8_t>(type)), amount(static_cast<std::int16_t>(amount)) {}
+    Move(const PokerMove& move) : Move(move.getType(), move.getAmount()) {}
+
+    static constexpr Move fold() {
+        return Move(PokerMove::Type::FOLD);
+    }
+
+    static constexpr Move call() {
+        return Move(PokerMove::Type::CALL);
+    }
+
+    static constexpr Move check() {
+        return Move(PokerMove::Type::CHECK);
+    }
+
+    static constexpr Move raise(int amount) {
+        return Move(PokerMove::Type::RAISE, amount);
+    }
+
+    constexpr PokerMove::Type getType() const {
+        return static_cast<PokerMove::Type>(type);
+    }
+
+    constexpr int getAmount() const {
+        return amount;
+    }
+
+    constexpr bool operator==(Move other) const {
+        return type == other.type && amount == other.amount;
+    }
+
+    constexpr bool operator!=(Move other) const {
+        return !(*this == other);
+    }
+
+    // Wire code sent to the engine: F, C, K or R<amount>.
+    std::string encode() const {
+        switch (getType()) {
+            case PokerMove::Type::FOLD:
+                return "F";
+            case PokerMove::Type::CALL:
+                return "C";
+            case PokerMove::Type::CHECK:
+                return "K";
+            case PokerMove::Type::RAISE:
+                return "R" + std::to_string(amount);
+        }
+        return "";
+    }
+
+    // Writes the wire code into buffer (at least 8 bytes) without
+    // allocating and returns its length.
+    std::size_t encodeTo(char* buffer) const {
+        switch (getType()) {
+            case PokerMove::Type::FOLD:
+                buffer[0] = 'F';
+                return 1;
+            case PokerMove::Type::CALL:
+                buffer[0] = 'C';
+                return 1;
+            case PokerMove::Type::CHECK:
+                buffer[0] = 'K';
+                return 1;
+            case PokerMove::Type::RAISE:
+                buffer[0] = 'R';
+                return static_cast<std::size_t>(std::to_chars(buffer + 1, buffer + 8, static_cast<int>(amount)).ptr - buffer);
+        }
+        return 0;
+    }
+
+    static Move decode(std::string_view code) {
+        if (code == "F") {
+            return fold();
+        }
+        if (code == "C") {
+            return call();
+        }
+        if (code == "K") {
+            return check();
+        }
+        if (code.size() > 1 && code[0] == 'R') {
+            return raise(std::stoi(std::string(code.substr(1))));
+        }
+        throw std::invalid_argument("Invalid move code: " + std::string(code));
+    }
+
+    std::string toString() const {
+        switch (getType()) {
+            case PokerMove::Type::FOLD:
+                return "Fold";
+            case PokerMove::Type::CALL:
+                return "Call";
+            case PokerMove::Type::CHECK:
+                return "Check";
+            case PokerMove::Type::RAISE:
+                return "Raise to " + std::to_string(amount);
+        }
+        return "";
+    }
+};
+
+static_assert(sizeof(Move) == 4, "Move should stay four bytes");
+static_assert(std::is_trivially_copyable_v<Move>, "Move must stay trivially copyable");
+
 #endif
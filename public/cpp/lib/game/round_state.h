@@ -4,11 +4,12 @@
 #include <array>
 #include <memory>
 #include <string>
-#include <vector>
 #include <variant>
 #include <unordered_set>
 #include <algorithm>
+#include "card.h"
 #include "game_constants.h"
+#include "legal_actions.h"
 #include "poker_moves.h"
 #include "terminal_state.h"
 
@@ -18,18 +19,18 @@ private:
     int street;
     std::array<int, 2> pips;
     std::array<int, 2> stacks;
-    std::array<std::vector<std::string>, 2> hands;
+    std::array<Hand, 2> hands;
     std::array<std::string, 2> bounties;
-    std::vector<std::string> deck;
+    Board deck;
     std::shared_ptr<RoundState> previousState;
 
 public:
     RoundState(int button, int street,
                const std::array<int, 2>& pips, 
                const std::array<int, 2>& stacks,
-               const std::array<std::vector<std::string>, 2>& hands, 
+               const std::array<Hand, 2>& hands,
                const std::array<std::string, 2>& bounties,
-               const std::vector<std::string>& deck, 
+               const Board& deck,
                std::shared_ptr<RoundState> previousState)
         : button(button), street(street), pips(pips), stacks(stacks),
           hands(hands), bounties(bounties), deck(deck), previousState(previousState) {}
@@ -50,7 +51,7 @@ public:
         return stacks;
     }
 
-    const std::array<std::vector<std::string>, 2>& getHands() const {
+    const std::array<Hand, 2>& getHands() const {
         return hands;
     }
 
@@ -58,7 +59,7 @@ public:
         return bounties;
     }
 
-    const std::vector<std::string>& getDeck() const {
+    const Board& getDeck() const {
         return deck;
     }
 
@@ -68,41 +69,14 @@ public:
 
     std::array<bool, 2> getBountyHits() const {
         std::array<bool, 2> hits = {false, false};
+        CardSet board = deck.getMask();
 
-        if (bounties[0] != "-1") {
-            char bountyRank = bounties[0][0];
-            for (const auto& card : hands[0]) {
-                if (!card.empty() && card[0] == bountyRank) {
-                    hits[0] = true;
-                    break;
-                }
-            }
-            if (!hits[0]) {
-                for (const auto& card : deck) {
-                    if (!card.empty() && card[0] == bountyRank) {
-                        hits[0] = true;
-                        break;
-                    }
-                }
-            }
-        }
-
-        if (bounties[1] != "-1") {
-            char bountyRank = bounties[1][0];
-            for (const auto& card : hands[1]) {
-                if (!card.empty() && card[0] == bountyRank) {
-                    hits[1] = true;
-                    break;
-                }
-            }
-            if (!hits[1]) {
-                for (const auto& card : deck) {
-                    if (!card.empty() && card[0] == bountyRank) {
-                        hits[1] = true;
-                        break;
-                    }
-                }
+        for (int player = 0; player < 2; player++) {
+            if (bounties[player] == "-1" || bounties[player].empty()) {
+                continue;
             }
+            int bountyRank = Card::rankFromChar(bounties[player][0]);
+            hits[player] = bountyRank >= 0 && (hands[player].getMask() | board).containsRank(bountyRank);
         }
 
         return hits;
@@ -113,40 +87,18 @@ public:
                                               std::const_pointer_cast<RoundState>(shared_from_this()));
     }
 
-    std::unordered_set<PokerMove::Type> getLegalActions() const {
-        int active = button % 2;
-        int continueCost = pips[1 - active] - pips[active];
-        std::unordered_set<PokerMove::Type> actions;
-
-        if (continueCost == 0) {
-            bool betsForbidden = stacks[0] == 0 || stacks[1] == 0;
-            actions.insert(PokerMove::Type::CHECK);
-            actions.insert(PokerMove::Type::FOLD);
-
-            if (!betsForbidden) {
-                actions.insert(PokerMove::Type::RAISE);
-            }
-        } else {
-            bool raisesForbidden = continueCost == stacks[active] || stacks[1 - active] == 0;
-            actions.insert(PokerMove::Type::FOLD);
-            actions.insert(PokerMove::Type::CALL);
-
-            if (!raisesForbidden) {
-                actions.insert(PokerMove::Type::RAISE);
-            }
-        }
+    // Legal actions and raise bounds in one pass; prefer this over the two
+    // calls below on hot paths.
+    ActionOptions getActionOptions() const {
+        return ActionOptions::compute(button % 2, pips, stacks);
+    }
 
-        return actions;
+    std::unordered_set<PokerMove::Type> getLegalActions() const {
+        return getActionOptions().legal.toSet();
     }
 
     std::array<int, 2> getRaiseBounds() const {
-        int active = button % 2;
-        int continueCost = pips[1 - active] - pips[active];
-        int maxContribution = std::min(stacks[active], stacks[1 - active] + continueCost);
-        int minContribution = std::min(maxContribution, 
-                                      continueCost + std::max(continueCost, GameConstants::BIG_BLIND));
-
-        return {pips[active] + minContribution, pips[active] + maxContribution};
+        return getActionOptions().raiseBounds;
     }
 
     std::variant<std::shared_ptr<RoundState>, std::shared_ptr<TerminalState>> proceedStreet() const {
@@ -162,12 +114,17 @@ public:
     }
 
     std::variant<std::shared_ptr<RoundState>, std::shared_ptr<TerminalState>> proceed(const PokerMove& action) const {
+        return proceed(Move(action));
+    }
+
+    std::variant<std::shared_ptr<RoundState>, std::shared_ptr<TerminalState>> proceed(Move action) const {
         int active = button % 2;
 
         if (action.getType() == PokerMove::Type::FOLD) {
             int delta = active == 0 ? stacks[0] - GameConstants::STARTING_STACK 
                                     : GameConstants::STARTING_STACK - stacks[1];
-            return std::make_shared<TerminalState>(std::array<int, 2>{delta, -delta}, &getBountyHits(), 
+            std::array<bool, 2> bountyHits = getBountyHits();
+            return std::make_shared<TerminalState>(std::array<int, 2>{delta, -delta}, &bountyHits,
                                                   std::const_pointer_cast<RoundState>(shared_from_this()));
         }
 
@@ -202,7 +159,7 @@ public:
         }
 
         if (action.getType() == PokerMove::Type::RAISE) {
-            int amount = dynamic_cast<const RaiseAction&>(action).getAmount();
+            int amount = action.getAmount();
             std::array<int, 2> newPips = pips;
             std::array<int, 2> newStacks = stacks;
             int contribution = amount - newPips[active];
@@ -4,6 +4,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include "game_constants.h"
 
 class RoundState;
 
@@ -37,6 +38,19 @@ public:
     std::shared_ptr<RoundState> getPreviousState() const {
         return previousState;
     }
+
+    // Settles chip deltas under the placeholder bounty rules in
+    // game_constants.h: a pot winner whose bounty hit collects
+    // delta * BOUNTY_RATIO + BOUNTY_CONSTANT instead.
+    static std::array<int, 2> applyBounties(const std::array<int, 2>& deltas, const std::array<bool, 2>& bountyHits) {
+        for (int player = 0; player < 2; player++) {
+            if (deltas[player] > 0 && bountyHits[player]) {
+                int won = static_cast<int>(deltas[player] * GameConstants::BOUNTY_RATIO) + GameConstants::BOUNTY_CONSTANT;
+                return player == 0 ? std::array<int, 2>{won, -won} : std::array<int, 2>{-won, won};
+            }
+        }
+        return deltas;
+    }
 };
 
 #endif
@@ -0,0 +1,168 @@
+#ifndef AIVAT_H
+#define AIVAT_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../eval/hand_evaluator.h"
+#include "../game/card.h"
+#include "../game/compact_round_state.h"
+#include "../game/game_constants.h"
+#include "../util/fast_rng.h"
+#include "local_match.h"
+
+struct AivatOptions {
+    // Runouts sampled to value a preflop pot; later streets are enumerated.
+    int preflopSamples = 2000;
+    std::uint64_t seed = 1;
+};
+
+// One round from seat 0's side: the chips won and the part of them that
+// the cards dealt after the first action explain.
+struct HandEstimate {
+    int payoff = 0;
+    double luck = 0.0;
+
+    double getValue() const {
+        return payoff - luck;
+    }
+};
+
+// Control-variate estimator in the spirit of AIVAT. The reference value of
+// a position is seat 0's expected payoff if both players checked it down
+// from there with the chips already in, bounties included. Every time a
+// board card is dealt, the change in that value is pure card luck with an
+// expected value of zero, so subtracting it leaves an unbiased estimate of
+// the round's outcome with far less variance. The preflop value is sampled
+// rather than enumerated, which stays unbiased.
+//
+// Only chance nodes are corrected: bots do not expose their action
+// probabilities, so the action terms of full AIVAT are left out, and luck
+// in the hole cards themselves is better removed with duplicate matches.
+class AivatEstimator {
+private:
+    // Checkdown outcome probabilities by seat: winning without and with the
+    // bounty hit. Each term scales with the pot in its own way.
+    struct Outcomes {
+        std::array<double, 2> plain = {0.0, 0.0};
+        std::array<double, 2> bounty = {0.0, 0.0};
+
+        double valueAt(int contribution) const {
+            const int bountyWon =
+                static_cast<int>(contribution * GameConstants::BOUNTY_RATIO) + GameConstants::BOUNTY_CONSTANT;
+            return (plain[0] - plain[1]) * contribution + (bounty[0] - bounty[1]) * bountyWon;
+        }
+    };
+
+    AivatOptions options;
+    FastRng rng;
+
+    static void addShowdown(Outcomes& outcomes, const std::array<CardSet, 2>& hands,
+                            const std::array<int, 2>& bountyRanks, CardSet board, double weight) {
+        HandEvaluator::HandRank rank0 = HandEvaluator::evaluate(hands[0] | board);
+        HandEvaluator::HandRank rank1 = HandEvaluator::evaluate(hands[1] | board);
+        if (rank0 == rank1) {
+            return;
+        }
+        const int winner = rank0 > rank1 ? 0 : 1;
+        const bool hit = bountyRanks[winner] >= 0 && (hands[winner] | board).containsRank(bountyRanks[winner]);
+        (hit ? outcomes.bounty : outcomes.plain)[winner] += weight;
+    }
+
+    Outcomes outcomesOf(const std::array<CardSet, 2>& hands, const std::array<int, 2>& bountyRanks, CardSet board) {
+        Outcomes outcomes;
+        const CardSet dead = hands[0] | hands[1] | board;
+        std::array<Card, Card::NUM_CARDS> live;
+        int count = 0;
+        for (int i = 0; i < Card::NUM_CARDS; i++) {
+            Card card = Card::fromIndex(i);
+            if (!dead.contains(card)) {
+                live[count++] = card;
+            }
+        }
+
+        const int missing = 5 - board.size();
+        if (missing == 0) {
+            addShowdown(outcomes, hands, bountyRanks, board, 1.0);
+        } else if (missing == 1) {
+            for (int i = 0; i < count; i++) {
+                addShowdown(outcomes, hands, bountyRanks, board | CardSet(live[i]), 1.0 / count);
+            }
+        } else if (missing == 2) {
+            const double weight = 2.0 / (count * (count - 1));
+            for (int i = 0; i < count; i++) {
+                for (int j = i + 1; j < count; j++) {
+                    addShowdown(outcomes, hands, bountyRanks, board | CardSet(live[i]) | CardSet(live[j]), weight);
+                }
+            }
+        } else {
+            const double weight = 1.0 / options.preflopSamples;
+            for (int sample = 0; sample < options.preflopSamples; sample++) {
+                CardSet runout = board;
+                for (int i = 0; i < missing; i++) {
+                    std::swap(live[i], live[i + static_cast<int>(rng.below(static_cast<std::uint32_t>(count - i)))]);
+                    runout.add(live[i]);
+                }
+                addShowdown(outcomes, hands, bountyRanks, runout, weight);
+            }
+        }
+        return outcomes;
+    }
+
+public:
+    explicit AivatEstimator(AivatOptions options = AivatOptions()) : options(options), rng(options.seed) {
+        if (options.preflopSamples < 1) {
+            throw std::invalid_argument("AivatOptions::preflopSamples must be positive");
+        }
+    }
+
+    HandEstimate estimate(const HandHistory& history) {
+        const std::array<CardSet, 2> hands = {history.hands[0].getMask(), history.hands[1].getMask()};
+        CompactRoundState state = CompactRoundState::deal(history.hands, history.board, history.bountyRanks);
+        Outcomes before;
+        bool valued = false;
+
+        HandEstimate estimate;
+        for (const ActionRecord& record : history.actions) {
+            const int street = state.getStreet();
+            state = state.proceed(record.move);
+            if (state.isTerminal() || state.getStreet() == street) {
+                continue;
+            }
+            // Betting closed with equal contributions; the next cards are
+            // dealt at this pot.
+            if (!valued) {
+                before = outcomesOf(hands, history.bountyRanks, CardSet());
+                valued = true;
+            }
+            const Outcomes after = outcomesOf(hands, history.bountyRanks, state.getBoardMask());
+            const int contribution = GameConstants::STARTING_STACK - state.getStacks()[0];
+            estimate.luck += after.valueAt(contribution) - before.valueAt(contribution);
+            before = after;
+        }
+        if (!state.isTerminal()) {
+            throw std::invalid_argument("HandHistory does not end the round");
+        }
+        estimate.payoff = state.getPayoffs()[0];
+        return estimate;
+    }
+
+    // Corrected deltas of the first bot, one per round, from a match played
+    // with MatchOptions::recordHands.
+    std::vector<double> correct(const MatchResult& result) {
+        if (result.hands.size() != result.deltas.size()) {
+            throw std::invalid_argument("MatchResult has no hand histories");
+        }
+        std::vector<double> corrected;
+        corrected.reserve(result.hands.size());
+        for (const HandHistory& history : result.hands) {
+            const double value = estimate(history).getValue();
+            corrected.push_back(history.firstSeat == 0 ? value : -value);
+        }
+        return corrected;
+    }
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef DUPLICATE_MATCH_H
+#define DUPLICATE_MATCH_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../base/base_bot.h"
+#include "local_match.h"
+
+using BotFactory = std::function<std::unique_ptr<BaseBot>(std::uint64_t seed)>;
+
+struct DuplicateResult {
+    MatchResult direct;
+    // Same deals with the bots swapped; indexed by bot as in direct, so
+    // bankrolls[0] is still the first bot's.
+    MatchResult mirrored;
+    // The first bot's combined delta over both seatings of each deal.
+    std::vector<int> pairDeltas;
+};
+
+// Duplicate match: every deal (hole cards, board and bounty ranks) is played
+// twice, the second time with each bot in the seat the other had. Card luck
+// cancels within a pair, so far fewer rounds separate two bots. Each seating
+// is a separate match with fresh bots, so nothing a bot learns in the
+// direct match carries over to the mirrored one.
+class DuplicateMatch {
+private:
+    BotFactory first;
+    BotFactory second;
+    MatchOptions options;
+
+public:
+    DuplicateMatch(BotFactory first, BotFactory second, MatchOptions options = MatchOptions())
+        : first(std::move(first)), second(std::move(second)), options(options) {}
+
+    DuplicateResult run() {
+        DuplicateResult result;
+        {
+            std::unique_ptr<BaseBot> a = first(options.seed);
+            std::unique_ptr<BaseBot> b = second(options.seed + 1);
+            result.direct = LocalMatch(*a, *b, options).run();
+        }
+        {
+            // With the same seed LocalMatch deals the same cards and bounty
+            // ranks to the same seats, so swapping the bot order swaps seats.
+            std::unique_ptr<BaseBot> a = first(options.seed + 2);
+            std::unique_ptr<BaseBot> b = second(options.seed + 3);
+            MatchResult swapped = LocalMatch(*b, *a, options).run();
+            result.mirrored.rounds = swapped.rounds;
+            for (int bot = 0; bot < 2; bot++) {
+                result.mirrored.bankrolls[bot] = swapped.bankrolls[1 - bot];
+                result.mirrored.bountyHits[bot] = swapped.bountyHits[1 - bot];
+                result.mirrored.timeUsed[bot] = swapped.timeUsed[1 - bot];
+            }
+            result.mirrored.deltas.reserve(swapped.deltas.size());
+            for (int delta : swapped.deltas) {
+                result.mirrored.deltas.push_back(-delta);
+            }
+            result.mirrored.hands = std::move(swapped.hands);
+            for (HandHistory& history : result.mirrored.hands) {
+                history.firstSeat = 1 - history.firstSeat;
+            }
+        }
+
+        result.pairDeltas.reserve(result.direct.deltas.size());
+        for (std::size_t round = 0; round < result.direct.deltas.size(); round++) {
+            result.pairDeltas.push_back(result.direct.deltas[round] + result.mirrored.deltas[round]);
+        }
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,248 @@
+#ifndef LOCAL_MATCH_H
+#define LOCAL_MATCH_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../base/base_bot.h"
+#include "../base/decision_context.h"
+#include "../base/time_budget.h"
+#include "../game/card.h"
+#include "../game/compact_round_state.h"
+#include "../game/game_constants.h"
+#include "../game/game_state.h"
+#include "../game/poker_moves.h"
+#include "../game/round_state.h"
+#include "../game/terminal_state.h"
+#include "../util/fast_rng.h"
+
+// Cards for one round: hole cards by seat (player index) and the full board.
+struct Deal {
+    std::array<Hand, 2> hands;
+    Board board;
+
+    static Deal random(FastRng& rng) {
+        std::array<int, 52> deck;
+        for (int i = 0; i < 52; i++) {
+            deck[i] = i;
+        }
+        for (int i = 0; i < 9; i++) {
+            std::swap(deck[i], deck[i + static_cast<int>(rng.below(static_cast<std::uint32_t>(52 - i)))]);
+        }
+        Deal deal;
+        for (int i = 0; i < 4; i++) {
+            deal.hands[i / 2].push_back(Card(deck[i] / 4, deck[i] % 4));
+        }
+        for (int i = 4; i < 9; i++) {
+            deal.board.push_back(Card(deck[i] / 4, deck[i] % 4));
+        }
+        return deal;
+    }
+};
+
+// Everything needed to replay one round, by seat: both players' cards, the
+// full board (only the streets reached were shown), bounty ranks and every
+// action in order.
+struct HandHistory {
+    std::array<Hand, 2> hands;
+    Board board;
+    std::array<int, 2> bountyRanks = {-1, -1};
+    ActionLog actions;
+    // Seat of the first bot of the match.
+    int firstSeat = 0;
+};
+
+struct MatchOptions {
+    int rounds = GameConstants::NUM_ROUNDS;
+    std::uint64_t seed = 1;
+    // Game clock per bot in seconds. 0 plays untimed (bots see an infinite
+    // clock), so the outcome depends only on the seed and the bots.
+    double clock = 0.0;
+    // Keep a HandHistory of every round in MatchResult::hands.
+    bool recordHands = false;
+};
+
+// Totals from one bot's point of view are indexed by bot (0 = first), not
+// by seat.
+struct MatchResult {
+    int rounds = 0;
+    std::array<int, 2> bankrolls = {0, 0};
+    std::array<int, 2> bountyHits = {0, 0};
+    std::array<double, 2> timeUsed = {0.0, 0.0};
+    // The first bot's delta in each round, for variance estimates.
+    std::vector<int> deltas;
+    // One per round when MatchOptions::recordHands is set.
+    std::vector<HandHistory> hands;
+};
+
+// Dealer for two in-process bots. Each bot sees exactly what the engine
+// would send it (its own cards and bounty, the visible board, every action)
+// through the BaseBot callbacks, without sockets or text. Seats alternate
+// every round and bounty ranks are redrawn every ROUNDS_PER_BOUNTY rounds.
+// The engine in private/game.py has no bounties, so that schedule follows
+// the placeholder rules in game_constants.h.
+class LocalMatch {
+private:
+    std::array<BaseBot*, 2> bots;
+    MatchOptions options;
+    FastRng rng;
+    MatchResult result;
+    std::array<int, 2> bountyRanks;
+    std::array<double, 2> clocks;
+    std::array<TimeBudget, 2> budgets;
+    std::array<int, 2> decisions;
+    std::array<std::unique_ptr<DecisionContext>, 2> contexts;
+    int roundNum;
+
+    GameState gameStateOf(int bot) const {
+        double clock = options.clock > 0.0 ? clocks[bot] : std::numeric_limits<double>::infinity();
+        return GameState(result.bankrolls[bot], clock, roundNum);
+    }
+
+    // The state as player seat sees it: own cards and bounty only.
+    static std::shared_ptr<RoundState> viewOf(const CompactRoundState& state, int seat,
+                                              std::shared_ptr<RoundState> previous, bool revealOpponent = false) {
+        std::array<Hand, 2> hands;
+        hands[seat] = state.getHand(seat);
+        if (revealOpponent) {
+            hands[1 - seat] = state.getHand(1 - seat);
+        }
+        std::array<std::string, 2> bounties = {"-1", "-1"};
+        const int bountyRank = state.getBountyRank(seat);
+        if (bountyRank >= 0) {
+            bounties[seat] = std::string(1, Card::rankToChar(bountyRank));
+        }
+        return std::make_shared<RoundState>(state.getButton(), state.getStreet(), state.getPips(), state.getStacks(),
+                                            hands, bounties, state.getBoard(), std::move(previous));
+    }
+
+    static Move legalize(const CompactRoundState& state, Move move) {
+        const ActionOptions options = state.getActionOptions();
+        bool inBounds = move.getType() != PokerMove::Type::RAISE ||
+                        (move.getAmount() >= options.raiseBounds[0] && move.getAmount() <= options.raiseBounds[1]);
+        if (options.legal.contains(move.getType()) && inBounds) {
+            return move;
+        }
+        return options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::fold();
+    }
+
+    Move ask(int bot, const RoundState& view, int seat) {
+        decisions[bot]++;
+        DecisionContext& context = *contexts[bot];
+        if (options.clock <= 0.0) {
+            context.reset(DecisionContext::Clock::time_point::max(), false);
+            return bots[bot]->getAction(gameStateOf(bot), view, seat, context);
+        }
+        // Out of time: the engine checks or folds for the bot.
+        if (clocks[bot] <= 0.0) {
+            return Move::check();
+        }
+        const GameState gameState = gameStateOf(bot);
+        const auto start = DecisionContext::Clock::now();
+        context.reset(budgets[bot].deadline(gameState, view.getStreet()), budgets[bot].isPanic(gameState));
+        Move move = bots[bot]->getAction(gameState, view, seat, context);
+        const double elapsed = std::chrono::duration<double>(DecisionContext::Clock::now() - start).count();
+        clocks[bot] -= elapsed;
+        result.timeUsed[bot] += elapsed;
+        return move;
+    }
+
+public:
+    LocalMatch(BaseBot& first, BaseBot& second, MatchOptions options = MatchOptions())
+        : bots{&first, &second}, options(options), rng(options.seed), result(), bountyRanks{0, 0},
+          clocks{options.clock, options.clock}, budgets(), decisions{0, 0},
+          contexts{std::make_unique<DecisionContext>(), std::make_unique<DecisionContext>()}, roundNum(1) {}
+
+    int getRoundNum() const {
+        return roundNum;
+    }
+
+    const MatchResult& getResult() const {
+        return result;
+    }
+
+    // Plays one round on the given cards with the given bounty ranks (by
+    // bot, -1 for none). firstSeat is the seat of the first bot. Returns
+    // the first bot's delta.
+    int playRound(const Deal& deal, const std::array<int, 2>& botBounties, int firstSeat) {
+        const std::array<int, 2> seatOf = {firstSeat, 1 - firstSeat};
+        const std::array<int, 2> botAt = {firstSeat == 0 ? 0 : 1, firstSeat == 0 ? 1 : 0};
+        CompactRoundState state =
+            CompactRoundState::deal(deal.hands, deal.board, {botBounties[botAt[0]], botBounties[botAt[1]]});
+
+        ActionLog actions;
+        std::array<std::shared_ptr<RoundState>, 2> views;
+        for (int bot = 0; bot < 2; bot++) {
+            views[bot] = viewOf(state, seatOf[bot], nullptr);
+            decisions[bot] = 0;
+            bots[bot]->handleNewRound(gameStateOf(bot), *views[bot], seatOf[bot]);
+        }
+
+        while (!state.isTerminal()) {
+            const int seat = state.getActive();
+            const int bot = botAt[seat];
+            Move move = legalize(state, ask(bot, *views[bot], seat));
+            state = actions.apply(state, move);
+            if (state.isTerminal()) {
+                break;
+            }
+            for (int b = 0; b < 2; b++) {
+                views[b] = viewOf(state, seatOf[b], views[b]);
+            }
+        }
+
+        const std::array<int, 2> payoffs = state.getPayoffs();
+        const std::array<bool, 2> hits = state.getBountyHits();
+        const bool showdown = state.getStatus() == CompactRoundState::Status::SHOWDOWN;
+        for (int bot = 0; bot < 2; bot++) {
+            result.bankrolls[bot] += payoffs[seatOf[bot]];
+            if (hits[seatOf[bot]]) {
+                result.bountyHits[bot]++;
+            }
+        }
+        for (int bot = 0; bot < 2; bot++) {
+            std::shared_ptr<RoundState> final = showdown ? viewOf(state, seatOf[bot], views[bot], true) : views[bot];
+            TerminalState terminal(payoffs, &hits, final);
+            bots[bot]->handleRoundOver(gameStateOf(bot), terminal, seatOf[bot]);
+            budgets[bot].observeRound(decisions[bot]);
+        }
+
+        const int delta = payoffs[seatOf[0]];
+        result.deltas.push_back(delta);
+        if (options.recordHands) {
+            HandHistory history;
+            history.hands = deal.hands;
+            history.board = deal.board;
+            history.bountyRanks = {state.getBountyRank(0), state.getBountyRank(1)};
+            history.actions = actions;
+            history.firstSeat = firstSeat;
+            result.hands.push_back(history);
+        }
+        result.rounds++;
+        roundNum++;
+        return delta;
+    }
+
+    // Plays the next round with fresh random cards, alternating seats and
+    // redrawing bounties on the placeholder schedule.
+    int playRound() {
+        if ((roundNum - 1) % GameConstants::ROUNDS_PER_BOUNTY == 0) {
+            bountyRanks = {static_cast<int>(rng.below(13)), static_cast<int>(rng.below(13))};
+        }
+        Deal deal = Deal::random(rng);
+        return playRound(deal, bountyRanks, (roundNum - 1) % 2);
+    }
+
+    MatchResult run() {
+        while (roundNum <= options.rounds) {
+            playRound();
+        }
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef MATCH_STATS_H
+#define MATCH_STATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../game/game_constants.h"
+
+// Win rate of one side of a pairing in big blinds per 100 rounds, with its
+// standard error. Rounds that share bounty ranks are correlated, so the
+// error comes from the spread of per-block totals (ROUNDS_PER_BOUNTY rounds
+// each) rather than of single rounds.
+class WinRate {
+private:
+    std::int64_t rounds;
+    double total;
+    // Running mean and sum of squared deviations of per-round block means.
+    std::int64_t blocks;
+    double blockMean;
+    double blockM2;
+
+    void addBlock(double meanPerRound) {
+        blocks++;
+        double delta = meanPerRound - blockMean;
+        blockMean += delta / blocks;
+        blockM2 += delta * (meanPerRound - blockMean);
+    }
+
+public:
+    WinRate() : rounds(0), total(0.0), blocks(0), blockMean(0.0), blockM2(0.0) {}
+
+    // Adds one match's per-round deltas, negated when they were recorded
+    // from the other side. Each entry may cover several rounds, e.g. both
+    // seatings of a duplicate deal; blocks then hold ROUNDS_PER_BOUNTY
+    // entries. Deltas may also be fractional estimates such as
+    // AivatEstimator's.
+    template <typename Delta>
+    void addMatch(const std::vector<Delta>& deltas, bool negate = false, int roundsPerEntry = 1) {
+        const double sign = negate ? -1.0 : 1.0;
+        const std::size_t blockSize = GameConstants::ROUNDS_PER_BOUNTY;
+        for (std::size_t start = 0; start < deltas.size(); start += blockSize) {
+            std::size_t end = std::min(deltas.size(), start + blockSize);
+            double sum = 0.0;
+            for (std::size_t i = start; i < end; i++) {
+                sum += sign * deltas[i];
+            }
+            const std::int64_t blockRounds = static_cast<std::int64_t>(end - start) * roundsPerEntry;
+            addBlock(sum / blockRounds);
+            total += sum;
+            rounds += blockRounds;
+        }
+    }
+
+    std::int64_t getRounds() const {
+        return rounds;
+    }
+
+    double getTotal() const {
+        return total;
+    }
+
+    double getBbPer100() const {
+        return rounds ? 100.0 * total / rounds / GameConstants::BIG_BLIND : 0.0;
+    }
+
+    // Standard error of getBbPer100(); 0 until there are two blocks.
+    double getStdError() const {
+        if (blocks < 2) {
+            return 0.0;
+        }
+        double variance = blockM2 / (blocks - 1);
+        return 100.0 * std::sqrt(variance / blocks) / GameConstants::BIG_BLIND;
+    }
+
+    // Two-sided interval around getBbPer100(); z = 1.96 gives 95%.
+    std::pair<double, double> getConfidenceInterval(double z = 1.96) const {
+        double center = getBbPer100();
+        double halfWidth = z * getStdError();
+        return {center - halfWidth, center + halfWidth};
+    }
+};
+
+struct SprtOptions {
+    // The two win rates to decide between, in bb/100.
+    double h0 = 0.0;
+    double h1 = 20.0;
+    // Chance of accepting h1 when h0 holds, and of accepting h0 when h1
+    // holds.
+    double alpha = 0.05;
+    double beta = 0.05;
+};
+
+// Sequential probability ratio test between two win rates, treating the
+// WinRate estimate as normal with its standard error (the generalized SPRT).
+// The test can be re-run after every match; a clear result stops it within
+// a few matches, and rates between h0 and h1 take longest.
+class Sprt {
+public:
+    enum class Decision {
+        CONTINUE,
+        ACCEPT_H0,
+        ACCEPT_H1
+    };
+
+private:
+    SprtOptions options;
+    double lowerBound;
+    double upperBound;
+
+public:
+    explicit Sprt(SprtOptions options = SprtOptions())
+        : options(options), lowerBound(std::log(options.beta / (1.0 - options.alpha))),
+          upperBound(std::log((1.0 - options.beta) / options.alpha)) {}
+
+    const SprtOptions& getOptions() const {
+        return options;
+    }
+
+    // Log-likelihood ratio of h1 over h0; 0 while the error is unknown.
+    double getLlr(const WinRate& winRate) const {
+        double error = winRate.getStdError();
+        if (error <= 0.0) {
+            return 0.0;
+        }
+        double center = winRate.getBbPer100();
+        return (options.h1 - options.h0) * (2.0 * center - options.h0 - options.h1) / (2.0 * error * error);
+    }
+
+    Decision decide(const WinRate& winRate) const {
+        double llr = getLlr(winRate);
+        if (llr >= upperBound) {
+            return Decision::ACCEPT_H1;
+        }
+        if (llr <= lowerBound) {
+            return Decision::ACCEPT_H0;
+        }
+        return Decision::CONTINUE;
+    }
+};
+
+#endif
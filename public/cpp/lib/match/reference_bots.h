@@ -0,0 +1,129 @@
+#ifndef REFERENCE_BOTS_H
+#define REFERENCE_BOTS_H
+
+#include <algorithm>
+#include <cstdint>
+#include "../base/base_bot.h"
+#include "../eval/hand_evaluator.h"
+#include "../eval/preflop_equity.h"
+#include "../game/card.h"
+#include "../game/game_constants.h"
+#include "../game/poker_moves.h"
+#include "../game/round_state.h"
+#include "../util/fast_rng.h"
+
+// Cheap, fixed strategies to benchmark against in local matches.
+
+// Checks when possible, otherwise calls.
+class CheckCallBot : public BaseBot {
+public:
+    void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) override {}
+
+    void handleRoundOver(const GameState& gameState, const TerminalState& terminalState, int active) override {}
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active) override {
+        return roundState.getActionOptions().legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::call();
+    }
+};
+
+// Min-raises whenever it can, otherwise checks or calls. Two of them play
+// the longest legal betting sequences, which makes a good stress case for
+// the dealer.
+class MinRaiseBot : public BaseBot {
+public:
+    void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) override {}
+
+    void handleRoundOver(const GameState& gameState, const TerminalState& terminalState, int active) override {}
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active) override {
+        const ActionOptions options = roundState.getActionOptions();
+        if (options.legal.contains(PokerMove::Type::RAISE)) {
+            return Move::raise(options.raiseBounds[0]);
+        }
+        return options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::call();
+    }
+};
+
+// Folds to a bet with probability foldRate and min-raises with probability
+// raiseRate; otherwise checks or calls.
+class RandomBot : public BaseBot {
+private:
+    FastRng rng;
+    double foldRate;
+    double raiseRate;
+
+public:
+    RandomBot(std::uint64_t seed, double foldRate = 0.1, double raiseRate = 0.2)
+        : rng(seed), foldRate(foldRate), raiseRate(raiseRate) {}
+
+    void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) override {}
+
+    void handleRoundOver(const GameState& gameState, const TerminalState& terminalState, int active) override {}
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active) override {
+        const ActionOptions options = roundState.getActionOptions();
+        double sample = rng.uniform();
+        if (options.legal.contains(PokerMove::Type::RAISE) && sample < raiseRate) {
+            return Move::raise(options.raiseBounds[0]);
+        }
+        if (options.legal.contains(PokerMove::Type::CHECK)) {
+            return Move::check();
+        }
+        return sample < raiseRate + foldRate ? Move::fold() : Move::call();
+    }
+};
+
+// Plays by hand strength alone: preflop equity against a random hand, and
+// postflop whether the hole cards improve on the board's own category.
+// threshold is the preflop equity needed to raise.
+class TightBot : public BaseBot {
+private:
+    double threshold;
+
+    // 0 = nothing, 1 = pair made with a hole card, 2 = two pair or better.
+    static int postflopStrength(const RoundState& roundState, int active) {
+        const Board& board = roundState.getDeck();
+        CardSet boardCards = board.getMask(static_cast<std::size_t>(roundState.getStreet()));
+        HandEvaluator::Category boardCategory = HandEvaluator::getCategory(HandEvaluator::evaluate(boardCards));
+        HandEvaluator::Category category =
+            HandEvaluator::getCategory(HandEvaluator::evaluate(boardCards | roundState.getHands()[active].getMask()));
+        if (category <= boardCategory) {
+            return 0;
+        }
+        return category >= HandEvaluator::Category::TWO_PAIR ? 2 : 1;
+    }
+
+public:
+    explicit TightBot(double threshold = 0.6) : threshold(threshold) {}
+
+    void handleNewRound(const GameState& gameState, const RoundState& roundState, int active) override {}
+
+    void handleRoundOver(const GameState& gameState, const TerminalState& terminalState, int active) override {}
+
+    Move getAction(const GameState& gameState, const RoundState& roundState, int active) override {
+        const ActionOptions options = roundState.getActionOptions();
+        const int continueCost = roundState.getPips()[1 - active] - roundState.getPips()[active];
+        int strength;
+        if (roundState.getStreet() == 0) {
+            double equity = PreflopEquity::equityVsRandom(roundState.getHands()[active]);
+            strength = equity >= threshold ? 2 : (equity >= 0.5 ? 1 : 0);
+        } else {
+            strength = postflopStrength(roundState, active);
+        }
+
+        if (strength == 2 && options.legal.contains(PokerMove::Type::RAISE)) {
+            int pot = 2 * GameConstants::STARTING_STACK - roundState.getStacks()[0] - roundState.getStacks()[1];
+            int amount = roundState.getPips()[active] + continueCost + pot;
+            return Move::raise(std::clamp(amount, options.raiseBounds[0], options.raiseBounds[1]));
+        }
+        if (options.legal.contains(PokerMove::Type::CHECK)) {
+            return Move::check();
+        }
+        if (strength > 0 || continueCost <= GameConstants::BIG_BLIND) {
+            return Move::call();
+        }
+        return Move::fold();
+    }
+};
+
+#endif
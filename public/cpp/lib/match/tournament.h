@@ -0,0 +1,198 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../base/base_bot.h"
+#include "../game/game_constants.h"
+#include "../util/work_stealing_pool.h"
+#include "aivat.h"
+#include "duplicate_match.h"
+#include "local_match.h"
+#include "match_stats.h"
+
+// A named way to build fresh bots; every match gets its own instances, so
+// bots may keep per-match state. The seed differs per match.
+struct Entrant {
+    std::string name;
+    BotFactory factory;
+};
+
+struct TournamentOptions {
+    int matchesPerPairing = 20;
+    int rounds = GameConstants::NUM_ROUNDS;
+    std::uint64_t seed = 1;
+    // Play each match as a duplicate pair (both seatings of every deal);
+    // a pairing then covers twice as many rounds.
+    bool duplicate = false;
+    // Also estimate every pairing with AivatEstimator.
+    bool aivat = false;
+    // Stop playing a pairing once an SPRT on its win rate (the corrected
+    // one with aivat) decides; matchesPerPairing is then the upper limit.
+    bool sprt = false;
+    SprtOptions sprtOptions;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+// Outcome of all matches between two entrants, from the first one's side.
+struct PairingResult {
+    int first = 0;
+    int second = 0;
+    int matches = 0;
+    WinRate winRate;
+    // Luck-corrected estimate of the same matches; empty unless
+    // TournamentOptions::aivat is set.
+    WinRate corrected;
+    std::array<int, 2> bountyHits = {0, 0};
+    double seconds = 0.0;
+    // Outcome of the SPRT; CONTINUE if it never decided or was off.
+    Sprt::Decision decision = Sprt::Decision::CONTINUE;
+    // Matches that threw instead of finishing, and the first error. They
+    // are left out of every total above.
+    int failures = 0;
+    std::string error;
+};
+
+// Round-robin between entrants, every match a separate task on a
+// work-stealing pool. Within a pairing the entrants alternate which of them
+// starts in seat 0, or in duplicate mode play every deal from both seats.
+// With the SPRT on, the remaining matches of a decided pairing are skipped;
+// matches already running still count. A match that throws is recorded in
+// its pairing's failures instead of ending the whole run.
+class Tournament {
+private:
+    std::vector<Entrant> entrants;
+    TournamentOptions options;
+
+    static std::uint64_t mix(std::uint64_t seed, std::uint64_t a, std::uint64_t b) {
+        std::uint64_t z = seed ^ (a * 0x9E3779B97F4A7C15ull) ^ (b * 0xC2B2AE3D27D4EB4Full);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+public:
+    Tournament(std::vector<Entrant> entrants, TournamentOptions options = TournamentOptions())
+        : entrants(std::move(entrants)), options(options) {}
+
+    const std::vector<Entrant>& getEntrants() const {
+        return entrants;
+    }
+
+    // Plays every pairing; onMatch(pairing index, matches done) is called
+    // after each match, serialized, for progress reporting.
+    std::vector<PairingResult> run(std::function<void(std::size_t, int)> onMatch = nullptr) {
+        std::vector<PairingResult> pairings;
+        for (int i = 0; i < static_cast<int>(entrants.size()); i++) {
+            for (int j = i + 1; j < static_cast<int>(entrants.size()); j++) {
+                PairingResult pairing;
+                pairing.first = i;
+                pairing.second = j;
+                pairings.push_back(pairing);
+            }
+        }
+
+        std::mutex resultsMutex;
+        const Sprt sprt(options.sprtOptions);
+        std::vector<int> swappedMatches(pairings.size(), 0);
+        WorkStealingPool pool(options.threads);
+        for (std::size_t p = 0; p < pairings.size(); p++) {
+            for (int match = 0; match < options.matchesPerPairing; match++) {
+                pool.submit([this, &pairings, &resultsMutex, &sprt, &swappedMatches, &onMatch, p, match]() {
+                    PairingResult& pairing = pairings[p];
+                    if (options.sprt) {
+                        std::lock_guard<std::mutex> lock(resultsMutex);
+                        if (pairing.decision != Sprt::Decision::CONTINUE) {
+                            return;
+                        }
+                    }
+                    const std::uint64_t seed = mix(options.seed, p, static_cast<std::uint64_t>(match));
+                    const Entrant& first = entrants[pairing.first];
+                    const Entrant& second = entrants[pairing.second];
+                    const bool swapped = !options.duplicate && match % 2 == 1;
+
+                    MatchOptions matchOptions;
+                    matchOptions.rounds = options.rounds;
+                    matchOptions.seed = seed;
+                    matchOptions.recordHands = options.aivat;
+                    AivatOptions aivatOptions;
+                    aivatOptions.seed = seed;
+                    AivatEstimator estimator(aivatOptions);
+                    using Clock = std::chrono::steady_clock;
+                    const auto start = Clock::now();
+                    std::vector<int> deltas;
+                    std::vector<double> corrected;
+                    std::array<int, 2> bountyHits;
+                    int roundsPerEntry = 1;
+                    try {
+                        if (options.duplicate) {
+                            DuplicateResult result = DuplicateMatch(first.factory, second.factory, matchOptions).run();
+                            deltas = std::move(result.pairDeltas);
+                            if (options.aivat) {
+                                corrected = estimator.correct(result.direct);
+                                const std::vector<double> mirrored = estimator.correct(result.mirrored);
+                                for (std::size_t round = 0; round < corrected.size(); round++) {
+                                    corrected[round] += mirrored[round];
+                                }
+                            }
+                            bountyHits = {result.direct.bountyHits[0] + result.mirrored.bountyHits[0],
+                                          result.direct.bountyHits[1] + result.mirrored.bountyHits[1]};
+                            roundsPerEntry = 2;
+                        } else {
+                            std::unique_ptr<BaseBot> a = first.factory(seed);
+                            std::unique_ptr<BaseBot> b = second.factory(seed + 1);
+                            MatchResult result = LocalMatch(swapped ? *b : *a, swapped ? *a : *b, matchOptions).run();
+                            if (options.aivat) {
+                                corrected = estimator.correct(result);
+                            }
+                            deltas = std::move(result.deltas);
+                            bountyHits = {result.bountyHits[swapped ? 1 : 0], result.bountyHits[swapped ? 0 : 1]};
+                        }
+                    } catch (const std::exception& error) {
+                        // Keep the other matches going; the failure is
+                        // reported with the pairing.
+                        std::lock_guard<std::mutex> lock(resultsMutex);
+                        if (pairing.failures++ == 0) {
+                            pairing.error = error.what();
+                        }
+                        return;
+                    }
+                    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+                    std::lock_guard<std::mutex> lock(resultsMutex);
+                    pairing.winRate.addMatch(deltas, swapped, roundsPerEntry);
+                    if (options.aivat) {
+                        pairing.corrected.addMatch(corrected, swapped, roundsPerEntry);
+                    }
+                    pairing.bountyHits[0] += bountyHits[0];
+                    pairing.bountyHits[1] += bountyHits[1];
+                    pairing.seconds += elapsed;
+                    pairing.matches++;
+                    swappedMatches[p] += swapped ? 1 : 0;
+                    // Without duplicate deals, only test once both seatings
+                    // have been played equally often.
+                    if (options.sprt && pairing.decision == Sprt::Decision::CONTINUE &&
+                        (options.duplicate || 2 * swappedMatches[p] == pairing.matches)) {
+                        pairing.decision = sprt.decide(options.aivat ? pairing.corrected : pairing.winRate);
+                    }
+                    if (onMatch) {
+                        onMatch(p, pairing.matches);
+                    }
+                });
+            }
+        }
+        pool.wait();
+        return pairings;
+    }
+};
+
+#endif
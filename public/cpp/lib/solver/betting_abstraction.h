@@ -0,0 +1,237 @@
+#ifndef BETTING_ABSTRACTION_H
+#define BETTING_ABSTRACTION_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include "../game/game_constants.h"
+#include "../game/legal_actions.h"
+#include "../game/round_state.h"
+
+namespace BettingAbstraction {
+    // Abstract actions. Sized raises are fractions of the pot after calling;
+    // FOLD is only offered when there is something to call.
+    enum Action : std::uint8_t {
+        FOLD,
+        CHECK_CALL,
+        RAISE_HALF_POT,
+        RAISE_POT,
+        RAISE_TWO_POT,
+        ALL_IN,
+        NUM_ACTIONS
+    };
+
+    constexpr float RAISE_FRACTIONS[] = {0.5f, 1.0f, 2.0f};
+
+    // Sized raises stop after this many actions on a street; all-in stays
+    // available, which keeps the tree finite.
+    constexpr int MAX_SIZED_RAISE_STEP = 4;
+
+    inline int roundOfStreet(int street) {
+        return street == 0 ? 0 : street - 2;
+    }
+}
+
+// Betting position of a hand under exactly the rules of RoundState::proceed,
+// as a small value type so the solver can copy it down the tree.
+struct BettingState {
+    enum class Outcome : std::uint8_t {
+        NONE,
+        FOLD,
+        SHOWDOWN
+    };
+
+    // Actions so far on the street; a real hand can take more than 127.
+    std::int16_t button;
+    std::int8_t street;
+    Outcome outcome;
+    std::int8_t folder;
+    std::array<std::int16_t, 2> pips;
+    std::array<std::int16_t, 2> stacks;
+
+    static BettingState initial() {
+        BettingState state{};
+        state.button = 0;
+        state.street = 0;
+        state.outcome = Outcome::NONE;
+        state.folder = -1;
+        state.pips = {GameConstants::SMALL_BLIND, GameConstants::BIG_BLIND};
+        state.stacks = {GameConstants::STARTING_STACK - GameConstants::SMALL_BLIND,
+                        GameConstants::STARTING_STACK - GameConstants::BIG_BLIND};
+        return state;
+    }
+
+    static BettingState fromRoundState(const RoundState& roundState) {
+        BettingState state{};
+        state.button = static_cast<std::int16_t>(roundState.getButton());
+        state.street = static_cast<std::int8_t>(roundState.getStreet());
+        state.outcome = Outcome::NONE;
+        state.folder = -1;
+        for (int player = 0; player < 2; player++) {
+            state.pips[player] = static_cast<std::int16_t>(roundState.getPips()[player]);
+            state.stacks[player] = static_cast<std::int16_t>(roundState.getStacks()[player]);
+        }
+        return state;
+    }
+
+    bool isTerminal() const {
+        return outcome != Outcome::NONE;
+    }
+
+    int getActive() const {
+        return button % 2;
+    }
+
+    int getRound() const {
+        return BettingAbstraction::roundOfStreet(street);
+    }
+
+    int getPot() const {
+        return 2 * GameConstants::STARTING_STACK - stacks[0] - stacks[1];
+    }
+
+    int getContinueCost() const {
+        int active = getActive();
+        return pips[1 - active] - pips[active];
+    }
+
+    // Number of actions taken so far on this street.
+    int getStep() const {
+        return street == 0 ? button : button - 1;
+    }
+
+    int getContribution(int player) const {
+        return GameConstants::STARTING_STACK - stacks[player];
+    }
+
+    ActionOptions getActionOptions() const {
+        return ActionOptions::compute(getActive(), {pips[0], pips[1]}, {stacks[0], stacks[1]});
+    }
+
+    // Raise-to amount for a raise action, within the legal bounds.
+    int getRaiseAmount(BettingAbstraction::Action action) const {
+        std::array<int, 2> bounds = getActionOptions().raiseBounds;
+        if (action == BettingAbstraction::ALL_IN) {
+            return bounds[1];
+        }
+        int continueCost = getContinueCost();
+        float fraction = BettingAbstraction::RAISE_FRACTIONS[action - BettingAbstraction::RAISE_HALF_POT];
+        int target = pips[getActive()] + continueCost + static_cast<int>(fraction * (getPot() + continueCost));
+        return std::clamp(target, bounds[0], bounds[1]);
+    }
+
+    // Writes the legal abstract actions to out and returns how many there
+    // are. Sized raises that would be all-in or duplicate a smaller size
+    // are dropped.
+    int getLegalActions(BettingAbstraction::Action* out) const {
+        using namespace BettingAbstraction;
+        const ActionOptions options = getActionOptions();
+        int count = 0;
+        if (getContinueCost() > 0) {
+            out[count++] = FOLD;
+        }
+        out[count++] = CHECK_CALL;
+        if (!options.legal.contains(PokerMove::Type::RAISE)) {
+            return count;
+        }
+        const int allIn = options.raiseBounds[1];
+        if (getStep() < MAX_SIZED_RAISE_STEP) {
+            int previous = -1;
+            for (int action = RAISE_HALF_POT; action <= RAISE_TWO_POT; action++) {
+                int amount = getRaiseAmount(static_cast<Action>(action));
+                if (amount > previous && amount < allIn) {
+                    out[count++] = static_cast<Action>(action);
+                    previous = amount;
+                }
+            }
+        }
+        out[count++] = ALL_IN;
+        return count;
+    }
+
+    BettingState apply(BettingAbstraction::Action action) const {
+        BettingState next = *this;
+        const int active = getActive();
+        if (action == BettingAbstraction::FOLD) {
+            next.outcome = Outcome::FOLD;
+            next.folder = static_cast<std::int8_t>(active);
+            return next;
+        }
+
+        if (action == BettingAbstraction::CHECK_CALL) {
+            int continueCost = getContinueCost();
+            if (continueCost == 0) {
+                if ((street == 0 && button > 0) || button > 1) {
+                    next.proceedStreet();
+                } else {
+                    next.button++;
+                }
+                return next;
+            }
+            next.stacks[active] -= continueCost;
+            next.pips[active] += continueCost;
+            if (button == 0) {
+                next.button = 1;
+                return next;
+            }
+            next.proceedStreet();
+            return next;
+        }
+
+        int amount = getRaiseAmount(action);
+        next.stacks[active] -= amount - pips[active];
+        next.pips[active] = amount;
+        next.button++;
+        return next;
+    }
+
+private:
+    // Once a player is all-in nobody can act again, so the remaining
+    // streets are skipped straight to showdown.
+    void proceedStreet() {
+        if (street == 5 || stacks[0] == 0 || stacks[1] == 0) {
+            outcome = Outcome::SHOWDOWN;
+            return;
+        }
+        street = street == 0 ? 3 : street + 1;
+        button = 1;
+        pips = {0, 0};
+    }
+};
+
+namespace BettingAbstraction {
+    namespace detail {
+        // Half-octave bucket of a positive value.
+        inline unsigned logBucket(unsigned value) {
+            if (value <= 1) {
+                return value;
+            }
+            unsigned top = 31 - static_cast<unsigned>(__builtin_clz(value));
+            return 2 * top + ((value >> (top - 1)) & 1);
+        }
+    }
+
+    // Information set key. Betting is summarized by the current situation
+    // (street, step, pot, price to call and stack depth) rather than the full
+    // action sequence, so the same key can be computed from a live RoundState.
+    inline std::uint64_t infoSetKey(const BettingState& state, int cardBucket, bool bountyHit) {
+        const unsigned pot = static_cast<unsigned>(state.getPot());
+        const unsigned continueCost = static_cast<unsigned>(state.getContinueCost());
+        const unsigned behind = static_cast<unsigned>(std::min(state.stacks[0], state.stacks[1]));
+        const std::uint64_t step = static_cast<std::uint64_t>(std::min(state.getStep(), 7));
+        const std::uint64_t potBucket = std::min(detail::logBucket(pot), 63u);
+        const std::uint64_t callBucket = std::min(continueCost * 4 / pot, 15u);
+        const std::uint64_t depthBucket = std::min(detail::logBucket(behind * 2 / pot), 15u);
+
+        std::uint64_t key = static_cast<std::uint64_t>(state.getRound());
+        key = key << 3 | step;
+        key = key << 6 | potBucket;
+        key = key << 4 | callBucket;
+        key = key << 4 | depthBucket;
+        key = key << 1 | (bountyHit ? 1 : 0);
+        key = key << 16 | static_cast<std::uint64_t>(cardBucket);
+        return key + 1;
+    }
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef BLUEPRINT_H
+#define BLUEPRINT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../game/round_state.h"
+#include "betting_abstraction.h"
+#include "card_abstraction.h"
+#include "regret_table.h"
+
+// Strategy file layout: this header followed by numEntries entries sorted by
+// key. tableRounds has bit r set when round r was bucketed from a bucket
+// file rather than by hand strength.
+struct BlueprintHeader {
+    static constexpr char MAGIC[8] = {'P', 'A', 'B', 'B', 'L', 'U', '0', '1'};
+
+    char magic[8];
+    std::uint64_t iterations;
+    std::uint64_t numEntries;
+    std::uint32_t strengthBuckets;
+    std::uint32_t tableRounds;
+};
+
+// Average strategy of one information set, quantized to 1/255 steps.
+struct BlueprintEntry {
+    std::uint64_t key;
+    std::uint8_t probabilities[BettingAbstraction::NUM_ACTIONS];
+    std::uint8_t padding[8 - BettingAbstraction::NUM_ACTIONS % 8];
+};
+
+// Read-only blueprint strategy produced by tools/mccfr_solver.cpp. Bots
+// query it with the live RoundState.
+class Blueprint {
+private:
+    BlueprintHeader header;
+    std::vector<BlueprintEntry> entries;
+    CardAbstraction abstraction;
+
+public:
+    Blueprint(const std::string& path, const std::string& abstractionDirectory)
+        : header(readHeader(path)), abstraction(abstractionDirectory, static_cast<int>(header.strengthBuckets)) {
+        for (int round = 0; round < 4; round++) {
+            if (abstraction.hasTable(round) != (((header.tableRounds >> round) & 1) != 0)) {
+                throw std::runtime_error("Blueprint " + path + " was trained with a different card abstraction");
+            }
+        }
+        std::ifstream in(path, std::ios::binary);
+        in.seekg(sizeof(BlueprintHeader));
+        entries.resize(header.numEntries);
+        if (!in.read(reinterpret_cast<char*>(entries.data()),
+                     static_cast<std::streamsize>(entries.size() * sizeof(BlueprintEntry)))) {
+            throw std::runtime_error("Truncated blueprint " + path);
+        }
+    }
+
+    static BlueprintHeader readHeader(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        BlueprintHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, BlueprintHeader::MAGIC, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Invalid blueprint " + path);
+        }
+        return header;
+    }
+
+    static void write(const std::string& path, const RegretTable& table, const CardAbstraction& abstraction,
+                      std::uint64_t iterations) {
+        std::vector<BlueprintEntry> entries;
+        entries.reserve(table.size());
+        table.forEach([&](const InfoSetNode& node) {
+            float total = 0.0f;
+            for (int a = 0; a < BettingAbstraction::NUM_ACTIONS; a++) {
+                total += node.getStrategySum(a);
+            }
+            if (total <= 0.0f) {
+                return;
+            }
+            BlueprintEntry entry{};
+            entry.key = node.key.load(std::memory_order_relaxed);
+            for (int a = 0; a < BettingAbstraction::NUM_ACTIONS; a++) {
+                entry.probabilities[a] = static_cast<std::uint8_t>(std::lround(255.0f * node.getStrategySum(a) / total));
+            }
+            entries.push_back(entry);
+        });
+        std::sort(entries.begin(), entries.end(), [](const BlueprintEntry& a, const BlueprintEntry& b) {
+            return a.key < b.key;
+        });
+
+        BlueprintHeader header{};
+        std::memcpy(header.magic, BlueprintHeader::MAGIC, sizeof(header.magic));
+        header.iterations = iterations;
+        header.numEntries = entries.size();
+        header.strengthBuckets = static_cast<std::uint32_t>(abstraction.getStrengthBuckets());
+        for (int round = 0; round < 4; round++) {
+            header.tableRounds |= abstraction.hasTable(round) ? 1u << round : 0u;
+        }
+
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(entries.data()),
+                      static_cast<std::streamsize>(entries.size() * sizeof(BlueprintEntry)));
+            if (!out) {
+                throw std::runtime_error("Failed to write blueprint " + temporary);
+            }
+        }
+        std::rename(temporary.c_str(), path.c_str());
+    }
+
+    std::uint64_t getIterations() const {
+        return header.iterations;
+    }
+
+    std::size_t size() const {
+        return entries.size();
+    }
+
+    const BlueprintEntry* find(std::uint64_t key) const {
+        auto it = std::lower_bound(entries.begin(), entries.end(), key, [](const BlueprintEntry& entry, std::uint64_t k) {
+            return entry.key < k;
+        });
+        return it != entries.end() && it->key == key ? &*it : nullptr;
+    }
+
+    // Fills the legal abstract actions for the active player and their
+    // blueprint probabilities, returning the action count. Returns 0 when
+    // the information set was never reached in training.
+    int getStrategy(const RoundState& roundState, int active, BettingAbstraction::Action* actions,
+                    float* probabilities) const {
+        BettingState state = BettingState::fromRoundState(roundState);
+        int count = state.getLegalActions(actions);
+
+        Board board;
+        for (int i = 0; i < roundState.getStreet(); i++) {
+            board.push_back(roundState.getDeck()[i]);
+        }
+        const Hand& hand = roundState.getHands()[active];
+        const std::string& bounty = roundState.getBounties()[active];
+        int bountyRank = bounty.empty() ? -1 : Card::rankFromChar(bounty[0]);
+        bool bountyHit = bountyRank >= 0 && (hand.getMask() | board.getMask()).containsRank(bountyRank);
+
+        const BlueprintEntry* entry = find(BettingAbstraction::infoSetKey(state, abstraction.getBucket(hand, board), bountyHit));
+        if (!entry) {
+            return 0;
+        }
+        float total = 0.0f;
+        for (int i = 0; i < count; i++) {
+            probabilities[i] = entry->probabilities[actions[i]];
+            total += probabilities[i];
+        }
+        for (int i = 0; i < count; i++) {
+            probabilities[i] = total > 0.0f ? probabilities[i] / total : 1.0f / count;
+        }
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef CARD_ABSTRACTION_H
+#define CARD_ABSTRACTION_H
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "../eval/batch_evaluator.h"
+#include "../eval/bucket_table.h"
+#include "../eval/hand_evaluator.h"
+#include "../eval/hole_combos.h"
+#include "../eval/preflop_equity.h"
+#include "../game/card.h"
+
+// Card buckets per round. Rounds with a bucket file (round<r>.bkt from the
+// abstraction builder) in the given directory use it; otherwise preflop uses
+// the 169 hand classes and later rounds use current hand strength against a
+// random hand, split into equal-width buckets.
+class CardAbstraction {
+private:
+    std::array<std::unique_ptr<BucketTable>, 4> tables;
+    int strengthBuckets;
+
+    int strengthBucket(const HandEvaluator::HandRank* ranks, CardSet hero, CardSet board) const {
+        const CardSet dead = hero | board;
+        const HandEvaluator::HandRank heroRank = HandEvaluator::evaluate(dead);
+        const std::uint64_t* combos = HoleCombos::masks();
+        int points = 0;
+        int total = 0;
+        for (int i = 0; i < HoleCombos::NUM_COMBOS; i++) {
+            if (combos[i] & dead.getBits()) {
+                continue;
+            }
+            points += heroRank > ranks[i] ? 2 : (heroRank == ranks[i] ? 1 : 0);
+            total += 2;
+        }
+        return std::min(strengthBuckets - 1, points * strengthBuckets / total);
+    }
+
+public:
+    explicit CardAbstraction(const std::string& directory = "", int strengthBuckets = 50)
+        : strengthBuckets(strengthBuckets) {
+        if (directory.empty()) {
+            return;
+        }
+        for (int round = 0; round < 4; round++) {
+            std::string path = directory + "/round" + std::to_string(round) + ".bkt";
+            if (std::ifstream(path).good()) {
+                tables[round] = std::make_unique<BucketTable>(path);
+            }
+        }
+    }
+
+    int getStrengthBuckets() const {
+        return strengthBuckets;
+    }
+
+    bool hasTable(int round) const {
+        return tables[round] != nullptr;
+    }
+
+    int getNumBuckets(int round) const {
+        if (tables[round]) {
+            return tables[round]->getNumBuckets();
+        }
+        return round == 0 ? PreflopEquity::NUM_CLASSES : strengthBuckets;
+    }
+
+    int getBucket(const Hand& hole, const Board& board) const {
+        int round = HandIndexer::roundOfBoard(board.size());
+        if (tables[round]) {
+            return tables[round]->getBucket(hole, board);
+        }
+        if (round == 0) {
+            return PreflopEquity::classOf(hole);
+        }
+        HandEvaluator::HandRank ranks[HoleCombos::NUM_COMBOS];
+        BatchEvaluator::evaluateBoard(board.getMask(), ranks);
+        return strengthBucket(ranks, hole.getMask(), board.getMask());
+    }
+
+    // Buckets both players for every round of a fully dealt hand, sharing
+    // the per-board rank tables between them.
+    void getBuckets(const std::array<Hand, 2>& hands, const Board& board, int buckets[2][4]) const {
+        static constexpr int BOARD_CARDS[] = {0, 3, 4, 5};
+        HandEvaluator::HandRank ranks[HoleCombos::NUM_COMBOS];
+        for (int round = 0; round < 4; round++) {
+            Board partial;
+            for (int i = 0; i < BOARD_CARDS[round]; i++) {
+                partial.push_back(board[i]);
+            }
+            if (round > 0 && !tables[round]) {
+                BatchEvaluator::evaluateBoard(partial.getMask(), ranks);
+                for (int player = 0; player < 2; player++) {
+                    buckets[player][round] = strengthBucket(ranks, hands[player].getMask(), partial.getMask());
+                }
+                continue;
+            }
+            for (int player = 0; player < 2; player++) {
+                buckets[player][round] = getBucket(hands[player], partial);
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef REGRET_TABLE_H
+#define REGRET_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "betting_abstraction.h"
+
+// One cache line per information set: the key plus cumulative regrets and
+// strategy sums for every abstract action. Values are relaxed atomics so
+// solver threads can update them lock-free; concurrent updates to the same
+// set may occasionally overwrite each other, which sampling noise swamps.
+struct alignas(64) InfoSetNode {
+    std::atomic<std::uint64_t> key;
+    std::atomic<float> regrets[BettingAbstraction::NUM_ACTIONS];
+    std::atomic<float> strategySum[BettingAbstraction::NUM_ACTIONS];
+
+    float getRegret(int action) const {
+        return regrets[action].load(std::memory_order_relaxed);
+    }
+
+    void addRegret(int action, float delta) {
+        regrets[action].store(regrets[action].load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    float getStrategySum(int action) const {
+        return strategySum[action].load(std::memory_order_relaxed);
+    }
+
+    void addStrategy(int action, float weight) {
+        strategySum[action].store(strategySum[action].load(std::memory_order_relaxed) + weight,
+                                  std::memory_order_relaxed);
+    }
+};
+
+// Fixed-capacity open-addressing table of information sets, shared by all
+// solver threads. Slots are claimed with a compare-and-swap on the key.
+class RegretTable {
+private:
+    static constexpr char MAGIC[8] = {'P', 'A', 'B', 'C', 'F', 'R', '0', '1'};
+
+    std::unique_ptr<InfoSetNode[]> nodes;
+    std::uint64_t mask;
+    std::atomic<std::uint64_t> used;
+
+    static std::uint64_t mix(std::uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDull;
+        key ^= key >> 33;
+        return key;
+    }
+
+public:
+    explicit RegretTable(int capacityLog2) : nodes(new InfoSetNode[std::uint64_t{1} << capacityLog2]),
+                                             mask((std::uint64_t{1} << capacityLog2) - 1), used(0) {
+        for (std::uint64_t i = 0; i <= mask; i++) {
+            nodes[i].key.store(0, std::memory_order_relaxed);
+            for (int a = 0; a < BettingAbstraction::NUM_ACTIONS; a++) {
+                nodes[i].regrets[a].store(0.0f, std::memory_order_relaxed);
+                nodes[i].strategySum[a].store(0.0f, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::uint64_t getCapacity() const {
+        return mask + 1;
+    }
+
+    std::uint64_t size() const {
+        return used.load(std::memory_order_relaxed);
+    }
+
+    // Finds or inserts key (never zero). Returns nullptr when the table is
+    // full, in which case the caller should play uniformly and not update.
+    InfoSetNode* find(std::uint64_t key) {
+        for (std::uint64_t slot = mix(key) & mask, probes = 0; probes <= mask; slot = (slot + 1) & mask, probes++) {
+            std::uint64_t current = nodes[slot].key.load(std::memory_order_acquire);
+            if (current == key) {
+                return &nodes[slot];
+            }
+            if (current == 0) {
+                if (used.load(std::memory_order_relaxed) * 10 >= (mask + 1) * 9) {
+                    return nullptr;
+                }
+                if (nodes[slot].key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                    used.fetch_add(1, std::memory_order_relaxed);
+                    return &nodes[slot];
+                }
+                if (current == key) {
+                    return &nodes[slot];
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (std::uint64_t i = 0; i <= mask; i++) {
+            if (nodes[i].key.load(std::memory_order_relaxed) != 0) {
+                visit(nodes[i]);
+            }
+        }
+    }
+
+    // Checkpoint layout: magic, iteration count, entry count, then per entry
+    // the key followed by regrets and strategy sums.
+    void save(const std::string& path, std::uint64_t iterations) const {
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            std::uint64_t count = 0;
+            out.write(MAGIC, sizeof(MAGIC));
+            out.write(reinterpret_cast<const char*>(&iterations), sizeof(iterations));
+            out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            forEach([&](const InfoSetNode& node) {
+                float values[2 * BettingAbstraction::NUM_ACTIONS];
+                std::uint64_t key = node.key.load(std::memory_order_relaxed);
+                for (int a = 0; a < BettingAbstraction::NUM_ACTIONS; a++) {
+                    values[a] = node.getRegret(a);
+                    values[BettingAbstraction::NUM_ACTIONS + a] = node.getStrategySum(a);
+                }
+                out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+                out.write(reinterpret_cast<const char*>(values), sizeof(values));
+                count++;
+            });
+            // Other threads may insert while we write, so the count is
+            // patched in afterwards.
+            out.seekp(sizeof(MAGIC) + sizeof(iterations));
+            out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            if (!out) {
+                throw std::runtime_error("Failed to write checkpoint " + temporary);
+            }
+        }
+        std::rename(temporary.c_str(), path.c_str());
+    }
+
+    // Loads a checkpoint into an empty table and returns its iteration count.
+    std::uint64_t load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        char magic[8];
+        std::uint64_t iterations = 0;
+        std::uint64_t count = 0;
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            !in.read(reinterpret_cast<char*>(&iterations), sizeof(iterations)) ||
+            !in.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+            throw std::runtime_error("Invalid checkpoint " + path);
+        }
+        for (std::uint64_t i = 0; i < count; i++) {
+            std::uint64_t key;
+            float values[2 * BettingAbstraction::NUM_ACTIONS];
+            if (!in.read(reinterpret_cast<char*>(&key), sizeof(key)) ||
+                !in.read(reinterpret_cast<char*>(values), sizeof(values))) {
+                throw std::runtime_error("Truncated checkpoint " + path);
+            }
+            InfoSetNode* node = find(key);
+            if (!node) {
+                throw std::runtime_error("Checkpoint does not fit in the regret table");
+            }
+            for (int a = 0; a < BettingAbstraction::NUM_ACTIONS; a++) {
+                node->regrets[a].store(values[a], std::memory_order_relaxed);
+                node->strategySum[a].store(values[BettingAbstraction::NUM_ACTIONS + a], std::memory_order_relaxed);
+            }
+        }
+        return iterations;
+    }
+};
+
+#endif
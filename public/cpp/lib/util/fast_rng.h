@@ -0,0 +1,64 @@
+#ifndef FAST_RNG_H
+#define FAST_RNG_H
+
+#include <cstdint>
+#include <limits>
+
+// xoshiro256** seeded through splitmix64. Satisfies UniformRandomBitGenerator,
+// so it also plugs into <random> distributions and std::shuffle.
+class FastRng {
+private:
+    std::uint64_t state[4];
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit FastRng(std::uint64_t seed = 0x9E3779B97F4A7C15ull) {
+        reseed(seed);
+    }
+
+    void reseed(std::uint64_t seed) {
+        for (auto& word : state) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    // Uniform integer in [0, bound) via Lemire's multiply-shift reduction.
+    std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+    double uniform() {
+        return ((*this)() >> 11) * 0x1.0p-53;
+    }
+};
+
+#endif
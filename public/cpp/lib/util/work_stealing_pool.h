@@ -0,0 +1,153 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker threads with one task deque each. Owners take their newest task
+// and idle workers steal the oldest task from the others, so long and
+// short jobs (e.g. matches between slow and fast bots) balance without a
+// single contended queue. Meant for batches: submit everything, then wait().
+class WorkStealingPool {
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    std::size_t queued;
+    std::size_t unfinished;
+    std::size_t nextQueue;
+    bool stopping;
+    std::exception_ptr error;
+
+    bool popOwn(std::size_t index, std::function<void()>& task) {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(std::size_t thief, std::function<void()>& task) {
+        for (std::size_t offset = 1; offset < queues.size(); offset++) {
+            Queue& queue = *queues[(thief + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(std::size_t index) {
+        while (true) {
+            std::function<void()> task;
+            if (popOwn(index, task) || steal(index, task)) {
+                {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                    queued--;
+                }
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                if (--unfinished == 0) {
+                    allDone.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            workAvailable.wait(lock, [this] { return stopping || queued > 0; });
+            if (stopping && queued == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit WorkStealingPool(unsigned numThreads = std::max(1u, std::thread::hardware_concurrency()))
+        : queued(0), unfinished(0), nextQueue(0), stopping(false) {
+        numThreads = std::max(1u, numThreads);
+        for (unsigned i = 0; i < numThreads; i++) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        for (unsigned i = 0; i < numThreads; i++) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    unsigned getNumThreads() const {
+        return static_cast<unsigned>(workers.size());
+    }
+
+    // Deals tasks round-robin over the worker deques.
+    void submit(std::function<void()> task) {
+        std::size_t index;
+        {
+            // Counted before the push so a worker can never finish the task
+            // before it is counted.
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            index = nextQueue++ % queues.size();
+            queued++;
+            unfinished++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        workAvailable.notify_one();
+    }
+
+    // Blocks until every submitted task has run, then rethrows the first
+    // exception any of them threw.
+    void wait() {
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        allDone.wait(lock, [this] { return unfinished == 0; });
+        if (error) {
+            std::exception_ptr thrown = error;
+            error = nullptr;
+            std::rethrow_exception(thrown);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,438 @@
+// Builds a card abstraction (bucket table) for one round of
+// HandIndexer::holdem() and writes it in the BucketTable file format.
+//
+//   g++ -std=c++17 -O3 -march=native -pthread tools/abstraction_builder.cpp -o abstraction_builder
+//   ./abstraction_builder --round 1 --buckets 2000 --out abstraction/
+//
+// Every canonical hand gets a feature: a histogram of its river equity
+// against a random hand over the possible runouts (exact when at most one
+// card is left to come, sampled otherwise), or the river equity itself on
+// the river. A training sample is clustered with k-means under L2 or
+// earth mover's distance, then every canonical hand is assigned to its
+// nearest centroid in chunks. Centroids and progress are stored next to the
+// output, so an interrupted run picks up where it stopped.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../lib/eval/batch_evaluator.h"
+#include "../lib/eval/bucket_table.h"
+#include "../lib/eval/hand_evaluator.h"
+#include "../lib/eval/hand_indexer.h"
+#include "../lib/eval/hole_combos.h"
+#include "../lib/game/card.h"
+#include "../lib/util/fast_rng.h"
+
+namespace {
+    enum class Distance {
+        L2,
+        EMD
+    };
+
+    struct Options {
+        int round = -1;
+        int numBuckets = 0;
+        std::string outDir = ".";
+        int bins = 50;
+        int runouts = 64;
+        int opponents = 0;
+        std::uint64_t trainSize = 1000000;
+        int iterations = 50;
+        Distance distance = Distance::EMD;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        std::uint64_t chunk = 1 << 16;
+        std::uint64_t seed = 1;
+    };
+
+    constexpr int BOARD_CARDS[] = {0, 3, 4, 5};
+
+    // River equity of hero against a uniformly random opponent hand, exact
+    // over all opponent combos or sampled when opponents > 0.
+    double riverEquity(CardSet hero, CardSet board, int opponents, FastRng& rng) {
+        const CardSet dead = hero | board;
+        const HandEvaluator::HandRank heroRank = HandEvaluator::evaluate(dead);
+        double points = 0.0;
+        double total = 0.0;
+        if (opponents == 0) {
+            HandEvaluator::HandRank ranks[HoleCombos::NUM_COMBOS];
+            BatchEvaluator::evaluateBoard(board, ranks);
+            const std::uint64_t* combos = HoleCombos::masks();
+            for (int i = 0; i < HoleCombos::NUM_COMBOS; i++) {
+                if (combos[i] & dead.getBits()) {
+                    continue;
+                }
+                points += heroRank > ranks[i] ? 1.0 : (heroRank == ranks[i] ? 0.5 : 0.0);
+                total += 1.0;
+            }
+        } else {
+            for (int i = 0; i < opponents; i++) {
+                int combo;
+                do {
+                    combo = static_cast<int>(rng.below(HoleCombos::NUM_COMBOS));
+                } while (HoleCombos::getMask(combo).intersects(dead));
+                HandEvaluator::HandRank rank = HandEvaluator::evaluate(HoleCombos::getMask(combo) | board);
+                points += heroRank > rank ? 1.0 : (heroRank == rank ? 0.5 : 0.0);
+                total += 1.0;
+            }
+        }
+        return points / total;
+    }
+
+    Card drawCard(FastRng& rng, CardSet& used) {
+        while (true) {
+            Card card = Card::fromIndex(static_cast<int>(rng.below(Card::NUM_CARDS)));
+            if (!used.contains(card)) {
+                used.add(card);
+                return card;
+            }
+        }
+    }
+
+    int featureSize(const Options& options) {
+        return options.round == 3 ? 1 : options.bins;
+    }
+
+    void computeFeature(const Options& options, std::uint64_t index, float* feature) {
+        FastRng rng(options.seed * 0x9E3779B97F4A7C15ull + index);
+        Card cards[7];
+        HandIndexer::holdem().unindex(options.round, index, cards);
+        CardSet hero = CardSet(cards[0]) | CardSet(cards[1]);
+        CardSet board;
+        for (int i = 0; i < BOARD_CARDS[options.round]; i++) {
+            board.add(cards[2 + i]);
+        }
+
+        if (options.round == 3) {
+            feature[0] = static_cast<float>(riverEquity(hero, board, options.opponents, rng));
+            return;
+        }
+
+        std::fill(feature, feature + options.bins, 0.0f);
+        auto record = [&](CardSet runoutBoard) {
+            double equity = riverEquity(hero, runoutBoard, options.opponents, rng);
+            int bin = std::min(options.bins - 1, static_cast<int>(equity * options.bins));
+            feature[bin] += 1.0f;
+        };
+
+        int samples = 0;
+        if (options.round == 2) {
+            for (int c = 0; c < Card::NUM_CARDS; c++) {
+                Card river = Card::fromIndex(c);
+                if (!(hero | board).contains(river)) {
+                    record(board | CardSet(river));
+                    samples++;
+                }
+            }
+        } else {
+            for (int s = 0; s < options.runouts; s++) {
+                CardSet used = hero | board;
+                CardSet runout = board;
+                for (int k = BOARD_CARDS[options.round]; k < 5; k++) {
+                    runout.add(drawCard(rng, used));
+                }
+                record(runout);
+                samples++;
+            }
+        }
+        for (int b = 0; b < options.bins; b++) {
+            feature[b] /= samples;
+        }
+        if (options.distance == Distance::EMD) {
+            for (int b = 1; b < options.bins; b++) {
+                feature[b] += feature[b - 1];
+            }
+        }
+    }
+
+    // With EMD the features are cumulative histograms, and the 1-D earth
+    // mover's distance is the L1 distance between them.
+    float distance(const Options& options, const float* a, const float* b, int dim) {
+        float total = 0.0f;
+        if (options.distance == Distance::EMD) {
+            for (int i = 0; i < dim; i++) {
+                total += std::fabs(a[i] - b[i]);
+            }
+        } else {
+            for (int i = 0; i < dim; i++) {
+                float d = a[i] - b[i];
+                total += d * d;
+            }
+        }
+        return total;
+    }
+
+    int nearest(const Options& options, const float* point, const std::vector<float>& centroids, int k, int dim) {
+        int best = 0;
+        float bestDistance = std::numeric_limits<float>::max();
+        for (int c = 0; c < k; c++) {
+            float d = distance(options, point, centroids.data() + static_cast<std::size_t>(c) * dim, dim);
+            if (d < bestDistance) {
+                bestDistance = d;
+                best = c;
+            }
+        }
+        return best;
+    }
+
+    template <typename Work>
+    void parallelFor(unsigned threads, std::uint64_t count, Work&& work) {
+        std::atomic<std::uint64_t> next{0};
+        const std::uint64_t block = 256;
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; t++) {
+            workers.emplace_back([&, t]() {
+                for (std::uint64_t start = next.fetch_add(block); start < count; start = next.fetch_add(block)) {
+                    std::uint64_t end = std::min(count, start + block);
+                    for (std::uint64_t i = start; i < end; i++) {
+                        work(t, i);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    std::vector<float> trainCentroids(const Options& options, int dim) {
+        const HandIndexer& indexer = HandIndexer::holdem();
+        const std::uint64_t total = indexer.size(options.round);
+        const std::uint64_t n = std::min(total, options.trainSize);
+        const int k = options.numBuckets;
+
+        std::vector<std::uint64_t> sample(n);
+        FastRng rng(options.seed);
+        for (std::uint64_t i = 0; i < n; i++) {
+            sample[i] = n == total ? i : ((rng() % total));
+        }
+
+        std::cerr << "Computing " << n << " training features" << std::endl;
+        std::vector<float> features(n * dim);
+        parallelFor(options.threads, n, [&](unsigned, std::uint64_t i) {
+            computeFeature(options, sample[i], features.data() + i * dim);
+        });
+
+        // k-means++ seeding over a bounded subsample keeps seeding cost
+        // independent of the training set size.
+        std::uint64_t seedPool = std::min<std::uint64_t>(n, 64ull * k);
+        std::vector<float> centroids(static_cast<std::size_t>(k) * dim);
+        std::vector<float> best(seedPool, std::numeric_limits<float>::max());
+        std::uint64_t first = rng() % seedPool;
+        std::copy_n(features.data() + first * dim, dim, centroids.data());
+        for (int c = 1; c < k; c++) {
+            const float* last = centroids.data() + static_cast<std::size_t>(c - 1) * dim;
+            double sum = 0.0;
+            for (std::uint64_t i = 0; i < seedPool; i++) {
+                best[i] = std::min(best[i], distance(options, features.data() + i * dim, last, dim));
+                sum += best[i];
+            }
+            double target = rng.uniform() * sum;
+            std::uint64_t pick = seedPool - 1;
+            for (std::uint64_t i = 0; i < seedPool; i++) {
+                target -= best[i];
+                if (target <= 0.0) {
+                    pick = i;
+                    break;
+                }
+            }
+            std::copy_n(features.data() + pick * dim, dim, centroids.data() + static_cast<std::size_t>(c) * dim);
+        }
+
+        std::vector<int> assignment(n, -1);
+        for (int iteration = 0; iteration < options.iterations; iteration++) {
+            std::vector<std::vector<double>> sums(options.threads, std::vector<double>(static_cast<std::size_t>(k) * dim));
+            std::vector<std::vector<std::uint64_t>> counts(options.threads, std::vector<std::uint64_t>(k));
+            std::atomic<std::uint64_t> changed{0};
+            parallelFor(options.threads, n, [&](unsigned t, std::uint64_t i) {
+                const float* point = features.data() + i * dim;
+                int c = nearest(options, point, centroids, k, dim);
+                if (c != assignment[i]) {
+                    assignment[i] = c;
+                    changed.fetch_add(1, std::memory_order_relaxed);
+                }
+                double* sum = sums[t].data() + static_cast<std::size_t>(c) * dim;
+                for (int d = 0; d < dim; d++) {
+                    sum[d] += point[d];
+                }
+                counts[t][c]++;
+            });
+
+            for (int c = 0; c < k; c++) {
+                std::uint64_t count = 0;
+                for (unsigned t = 0; t < options.threads; t++) {
+                    count += counts[t][c];
+                }
+                if (count == 0) {
+                    continue;
+                }
+                for (int d = 0; d < dim; d++) {
+                    double sum = 0.0;
+                    for (unsigned t = 0; t < options.threads; t++) {
+                        sum += sums[t][static_cast<std::size_t>(c) * dim + d];
+                    }
+                    centroids[static_cast<std::size_t>(c) * dim + d] = static_cast<float>(sum / count);
+                }
+            }
+
+            std::cerr << "Iteration " << iteration << ": " << changed.load() << " reassigned" << std::endl;
+            if (changed.load() <= n / 1000) {
+                break;
+            }
+        }
+        return centroids;
+    }
+
+    std::string roundPath(const Options& options, const char* suffix) {
+        return options.outDir + "/round" + std::to_string(options.round) + suffix;
+    }
+
+    bool loadCentroids(const Options& options, int dim, std::vector<float>& centroids) {
+        std::ifstream in(roundPath(options, ".centroids"), std::ios::binary);
+        std::uint32_t header[3];
+        if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+            header[0] != static_cast<std::uint32_t>(options.numBuckets) ||
+            header[1] != static_cast<std::uint32_t>(dim) ||
+            header[2] != static_cast<std::uint32_t>(options.distance)) {
+            return false;
+        }
+        centroids.resize(static_cast<std::size_t>(options.numBuckets) * dim);
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(centroids.data()),
+                                         static_cast<std::streamsize>(centroids.size() * sizeof(float))));
+    }
+
+    void saveCentroids(const Options& options, int dim, const std::vector<float>& centroids) {
+        std::ofstream out(roundPath(options, ".centroids"), std::ios::binary | std::ios::trunc);
+        std::uint32_t header[3] = {static_cast<std::uint32_t>(options.numBuckets), static_cast<std::uint32_t>(dim),
+                                   static_cast<std::uint32_t>(options.distance)};
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(centroids.data()),
+                  static_cast<std::streamsize>(centroids.size() * sizeof(float)));
+    }
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--round") {
+                options.round = std::stoi(value);
+            } else if (arg == "--buckets") {
+                options.numBuckets = std::stoi(value);
+            } else if (arg == "--out") {
+                options.outDir = value;
+            } else if (arg == "--bins") {
+                options.bins = std::stoi(value);
+            } else if (arg == "--runouts") {
+                options.runouts = std::stoi(value);
+            } else if (arg == "--opponents") {
+                options.opponents = std::stoi(value);
+            } else if (arg == "--train") {
+                options.trainSize = std::stoull(value);
+            } else if (arg == "--iterations") {
+                options.iterations = std::stoi(value);
+            } else if (arg == "--distance") {
+                options.distance = value == "l2" ? Distance::L2 : Distance::EMD;
+            } else if (arg == "--threads") {
+                options.threads = static_cast<unsigned>(std::max(1, std::stoi(value)));
+            } else if (arg == "--chunk") {
+                options.chunk = std::stoull(value);
+            } else if (arg == "--seed") {
+                options.seed = std::stoull(value);
+            } else {
+                std::cerr << "Unknown option " << arg << std::endl;
+                return false;
+            }
+        }
+        if (options.round < 0 || options.round > 3 || options.numBuckets <= 0 || options.numBuckets > 65535) {
+            std::cerr << "Usage: abstraction_builder --round 0-3 --buckets K [--out DIR] [--bins N] "
+                         "[--runouts N] [--opponents N] [--train N] [--iterations N] [--distance l2|emd] "
+                         "[--threads N] [--chunk N] [--seed N]" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    const HandIndexer& indexer = HandIndexer::holdem();
+    const std::uint64_t total = indexer.size(options.round);
+    const bool lossless = static_cast<std::uint64_t>(options.numBuckets) >= total;
+    const int dim = featureSize(options);
+    const std::string path = roundPath(options, ".bkt");
+
+    BucketFileHeader header{};
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    bool resume = file && file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                  std::memcmp(header.magic, BucketFileHeader::MAGIC, sizeof(header.magic)) == 0 &&
+                  header.round == static_cast<std::uint32_t>(options.round) &&
+                  header.numBuckets == static_cast<std::uint32_t>(options.numBuckets) &&
+                  header.numEntries == total;
+
+    std::vector<float> centroids;
+    if (!lossless && !(resume && loadCentroids(options, dim, centroids))) {
+        resume = false;
+        centroids = trainCentroids(options, dim);
+        saveCentroids(options, dim, centroids);
+    }
+
+    if (!resume) {
+        file.close();
+        file.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        std::memcpy(header.magic, BucketFileHeader::MAGIC, sizeof(header.magic));
+        header.round = static_cast<std::uint32_t>(options.round);
+        header.numBuckets = static_cast<std::uint32_t>(options.numBuckets);
+        header.numEntries = total;
+        header.completedEntries = 0;
+        header.dataOffset = sizeof(BucketFileHeader);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    } else {
+        file.clear();
+        std::cerr << "Resuming at " << header.completedEntries << "/" << total << std::endl;
+    }
+
+    std::vector<std::uint16_t> chunk;
+    std::vector<std::vector<float>> scratch(options.threads, std::vector<float>(dim));
+    while (header.completedEntries < total) {
+        std::uint64_t start = header.completedEntries;
+        std::uint64_t count = std::min(options.chunk, total - start);
+        chunk.assign(count, 0);
+        parallelFor(options.threads, count, [&](unsigned t, std::uint64_t i) {
+            if (lossless) {
+                chunk[i] = static_cast<std::uint16_t>(start + i);
+                return;
+            }
+            computeFeature(options, start + i, scratch[t].data());
+            chunk[i] = static_cast<std::uint16_t>(nearest(options, scratch[t].data(), centroids, options.numBuckets, dim));
+        });
+
+        file.seekp(static_cast<std::streamoff>(header.dataOffset + start * sizeof(std::uint16_t)));
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(count * sizeof(std::uint16_t)));
+        file.flush();
+        header.completedEntries = start + count;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.flush();
+        if (!file) {
+            std::cerr << "Write failed for " << path << std::endl;
+            return 1;
+        }
+        std::cerr << header.completedEntries << "/" << total << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,306 @@
+// Trains a blueprint strategy for the heads-up game implemented by
+// RoundState::proceed (stacks, blinds and the placeholder bounty rules
+// from game_constants.h) with external-sampling Monte Carlo CFR.
+//
+//   g++ -std=c++17 -O3 -march=native -pthread tools/mccfr_solver.cpp -o mccfr_solver
+//   ./mccfr_solver --out blueprint.bin --seconds 3600 [--abstraction abstraction/]
+//
+// All threads share one lock-free regret table. A checkpoint and the
+// blueprint are rewritten every --checkpoint seconds and on exit (including
+// Ctrl-C); --resume continues from the checkpoint. Bots load the blueprint
+// with Blueprint (lib/solver/blueprint.h) using the same abstraction
+// directory.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../lib/eval/hand_evaluator.h"
+#include "../lib/game/card.h"
+#include "../lib/game/terminal_state.h"
+#include "../lib/solver/betting_abstraction.h"
+#include "../lib/solver/blueprint.h"
+#include "../lib/solver/card_abstraction.h"
+#include "../lib/solver/regret_table.h"
+#include "../lib/util/fast_rng.h"
+
+namespace {
+    using BettingAbstraction::Action;
+    using BettingAbstraction::NUM_ACTIONS;
+
+    volatile std::sig_atomic_t interrupted = 0;
+
+    struct Options {
+        std::string out = "blueprint.bin";
+        std::string checkpoint = "blueprint.ckpt";
+        std::string abstractionDir;
+        int strengthBuckets = 50;
+        std::uint64_t iterations = 0;
+        double seconds = 0.0;
+        double checkpointSeconds = 600.0;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        int tableLog2 = 22;
+        bool resume = false;
+        std::uint64_t seed = 1;
+    };
+
+    // Everything chance decides for one hand, sampled up front.
+    struct Deal {
+        int buckets[2][4];
+        bool bountyHits[2][4];
+        int winner;
+    };
+
+    Deal dealHand(FastRng& rng, const CardAbstraction& abstraction) {
+        CardSet used;
+        auto draw = [&]() {
+            while (true) {
+                Card card = Card::fromIndex(static_cast<int>(rng.below(Card::NUM_CARDS)));
+                if (!used.contains(card)) {
+                    used.add(card);
+                    return card;
+                }
+            }
+        };
+        std::array<Hand, 2> hands;
+        Board board;
+        for (int player = 0; player < 2; player++) {
+            hands[player].push_back(draw());
+            hands[player].push_back(draw());
+        }
+        for (int i = 0; i < 5; i++) {
+            board.push_back(draw());
+        }
+
+        Deal deal;
+        abstraction.getBuckets(hands, board, deal.buckets);
+        static constexpr int BOARD_CARDS[] = {0, 3, 4, 5};
+        for (int player = 0; player < 2; player++) {
+            int bountyRank = static_cast<int>(rng.below(13));
+            for (int round = 0; round < 4; round++) {
+                deal.bountyHits[player][round] = (hands[player].getMask() | board.getMask(BOARD_CARDS[round])).containsRank(bountyRank);
+            }
+        }
+        HandEvaluator::HandRank ranks[2] = {HandEvaluator::evaluate(hands[0], board),
+                                            HandEvaluator::evaluate(hands[1], board)};
+        deal.winner = ranks[0] > ranks[1] ? 0 : (ranks[1] > ranks[0] ? 1 : -1);
+        return deal;
+    }
+
+    float payoff(const BettingState& state, int traverser, const Deal& deal) {
+        int winner;
+        int amount;
+        int round;
+        if (state.outcome == BettingState::Outcome::FOLD) {
+            winner = 1 - state.folder;
+            amount = state.getContribution(state.folder);
+            round = state.getRound();
+        } else {
+            if (deal.winner < 0) {
+                return 0.0f;
+            }
+            winner = deal.winner;
+            amount = state.getContribution(1 - winner);
+            round = 3;
+        }
+        std::array<int, 2> deltas = winner == 0 ? std::array<int, 2>{amount, -amount} : std::array<int, 2>{-amount, amount};
+        std::array<bool, 2> hits = {deal.bountyHits[0][round], deal.bountyHits[1][round]};
+        return static_cast<float>(TerminalState::applyBounties(deltas, hits)[traverser]);
+    }
+
+    void currentStrategy(const InfoSetNode* node, const Action* actions, int count, float* strategy) {
+        float total = 0.0f;
+        for (int i = 0; i < count; i++) {
+            strategy[i] = node ? std::max(node->getRegret(actions[i]), 0.0f) : 0.0f;
+            total += strategy[i];
+        }
+        for (int i = 0; i < count; i++) {
+            strategy[i] = total > 0.0f ? strategy[i] / total : 1.0f / count;
+        }
+    }
+
+    class Trainer {
+    private:
+        RegretTable& table;
+        FastRng rng;
+
+    public:
+        Trainer(RegretTable& table, std::uint64_t seed) : table(table), rng(seed) {}
+
+        FastRng& getRng() {
+            return rng;
+        }
+
+        float traverse(const BettingState& state, int traverser, const Deal& deal) {
+            if (state.isTerminal()) {
+                return payoff(state, traverser, deal);
+            }
+
+            Action actions[NUM_ACTIONS];
+            int count = state.getLegalActions(actions);
+            if (count == 1) {
+                return traverse(state.apply(actions[0]), traverser, deal);
+            }
+
+            const int active = state.getActive();
+            const int round = state.getRound();
+            InfoSetNode* node = table.find(BettingAbstraction::infoSetKey(state, deal.buckets[active][round],
+                                                                          deal.bountyHits[active][round]));
+            float strategy[NUM_ACTIONS];
+            currentStrategy(node, actions, count, strategy);
+
+            if (active == traverser) {
+                float values[NUM_ACTIONS];
+                float nodeValue = 0.0f;
+                for (int i = 0; i < count; i++) {
+                    values[i] = traverse(state.apply(actions[i]), traverser, deal);
+                    nodeValue += strategy[i] * values[i];
+                }
+                if (node) {
+                    for (int i = 0; i < count; i++) {
+                        node->addRegret(actions[i], values[i] - nodeValue);
+                    }
+                }
+                return nodeValue;
+            }
+
+            if (node) {
+                for (int i = 0; i < count; i++) {
+                    node->addStrategy(actions[i], strategy[i]);
+                }
+            }
+            float sample = static_cast<float>(rng.uniform());
+            int choice = count - 1;
+            for (int i = 0; i < count - 1; i++) {
+                sample -= strategy[i];
+                if (sample < 0.0f) {
+                    choice = i;
+                    break;
+                }
+            }
+            return traverse(state.apply(actions[choice]), traverser, deal);
+        }
+    };
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--resume") {
+                options.resume = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--out") {
+                options.out = value;
+            } else if (arg == "--checkpoint-file") {
+                options.checkpoint = value;
+            } else if (arg == "--abstraction") {
+                options.abstractionDir = value;
+            } else if (arg == "--strength-buckets") {
+                options.strengthBuckets = std::stoi(value);
+            } else if (arg == "--iterations") {
+                options.iterations = std::stoull(value);
+            } else if (arg == "--seconds") {
+                options.seconds = std::stod(value);
+            } else if (arg == "--checkpoint") {
+                options.checkpointSeconds = std::stod(value);
+            } else if (arg == "--threads") {
+                options.threads = static_cast<unsigned>(std::max(1, std::stoi(value)));
+            } else if (arg == "--table-log2") {
+                options.tableLog2 = std::stoi(value);
+            } else if (arg == "--seed") {
+                options.seed = std::stoull(value);
+            } else {
+                std::cerr << "Usage: mccfr_solver [--out FILE] [--checkpoint-file FILE] [--abstraction DIR] "
+                             "[--strength-buckets N] [--iterations N] [--seconds S] [--checkpoint S] "
+                             "[--threads N] [--table-log2 N] [--seed N] [--resume]" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+    std::signal(SIGINT, [](int) { interrupted = 1; });
+    std::signal(SIGTERM, [](int) { interrupted = 1; });
+
+    CardAbstraction abstraction(options.abstractionDir, options.strengthBuckets);
+    RegretTable table(options.tableLog2);
+    std::uint64_t startIteration = 0;
+    if (options.resume) {
+        startIteration = table.load(options.checkpoint);
+        std::cerr << "Resumed " << table.size() << " information sets at iteration " << startIteration << std::endl;
+    }
+
+    std::atomic<std::uint64_t> iterations{startIteration};
+    std::atomic<bool> stopping{false};
+    const std::uint64_t limit = options.iterations ? startIteration + options.iterations : 0;
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < options.threads; t++) {
+        workers.emplace_back([&, t]() {
+            Trainer trainer(table, options.seed * 0x9E3779B97F4A7C15ull + startIteration + t);
+            while (!stopping.load(std::memory_order_relaxed)) {
+                std::uint64_t iteration = iterations.fetch_add(1, std::memory_order_relaxed);
+                if (limit && iteration >= limit) {
+                    break;
+                }
+                Deal deal = dealHand(trainer.getRng(), abstraction);
+                trainer.traverse(BettingState::initial(), 0, deal);
+                trainer.traverse(BettingState::initial(), 1, deal);
+            }
+        });
+    }
+
+    auto save = [&]() {
+        std::uint64_t done = std::min(iterations.load(), limit ? limit : UINT64_MAX);
+        table.save(options.checkpoint, done);
+        Blueprint::write(options.out, table, abstraction, done);
+    };
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    auto lastCheckpoint = start;
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        const auto now = Clock::now();
+        const double elapsed = std::chrono::duration<double>(now - start).count();
+        const std::uint64_t done = iterations.load(std::memory_order_relaxed) - startIteration;
+        const bool finished = interrupted || (limit && done >= options.iterations) ||
+                              (options.seconds > 0.0 && elapsed >= options.seconds);
+        if (finished) {
+            break;
+        }
+        if (std::chrono::duration<double>(now - lastCheckpoint).count() >= options.checkpointSeconds) {
+            save();
+            lastCheckpoint = now;
+            std::cerr << done << " iterations, " << done / elapsed / options.threads << " it/s/thread, "
+                      << table.size() << " information sets" << std::endl;
+        }
+    }
+
+    stopping = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    save();
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    const std::uint64_t done = std::min(iterations.load(), limit ? limit : UINT64_MAX) - startIteration;
+    std::cerr << done << " iterations in " << elapsed << "s (" << done / elapsed / options.threads
+              << " it/s/thread), " << table.size() << " information sets" << std::endl;
+    return 0;
+}
@@ -0,0 +1,226 @@
+// Generates lib/eval/preflop_equity_table.h.
+//
+//   g++ -std=c++17 -O3 -march=native -pthread tools/preflop_table_gen.cpp -o preflop_table_gen
+//   ./preflop_table_gen lib/eval/preflop_equity_table.h
+//
+// Every class-vs-class matchup is reduced to its suit-isomorphic combo
+// matchups (about 47k in total), each of which is enumerated exactly over
+// all 1.7M boards. Runs on all cores; expect tens of minutes per core.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../lib/eval/batch_evaluator.h"
+#include "../lib/eval/hole_combos.h"
+#include "../lib/game/card.h"
+
+namespace {
+    constexpr int NUM_CLASSES = 169;
+    constexpr int CHUNK = 1024;
+
+    int classOf(Card a, Card b) {
+        int high = std::max(a.getRank(), b.getRank());
+        int low = std::min(a.getRank(), b.getRank());
+        bool suited = a.getSuit() == b.getSuit() && high != low;
+        return suited ? high * 13 + low : low * 13 + high;
+    }
+
+    std::uint32_t packMatchup(std::array<int, 4> cards) {
+        if (cards[0] > cards[1]) {
+            std::swap(cards[0], cards[1]);
+        }
+        if (cards[2] > cards[3]) {
+            std::swap(cards[2], cards[3]);
+        }
+        return static_cast<std::uint32_t>(cards[0] | cards[1] << 8 | cards[2] << 16 | cards[3] << 24);
+    }
+
+    std::uint32_t canonicalMatchup(int heroCombo, int opponentCombo) {
+        std::array<int, 4> suits = {0, 1, 2, 3};
+        std::array<Card, 4> cards = {HoleCombos::firstCard(heroCombo), HoleCombos::secondCard(heroCombo),
+                                     HoleCombos::firstCard(opponentCombo), HoleCombos::secondCard(opponentCombo)};
+        std::uint32_t best = UINT32_MAX;
+        do {
+            std::array<int, 4> mapped;
+            for (int i = 0; i < 4; i++) {
+                mapped[i] = Card(cards[i].getRank(), suits[cards[i].getSuit()]).getIndex();
+            }
+            best = std::min(best, packMatchup(mapped));
+        } while (std::next_permutation(suits.begin(), suits.end()));
+        return best;
+    }
+
+    std::vector<CardSet> allBoards() {
+        std::vector<CardSet> boards;
+        boards.reserve(2598960);
+        for (int a = 0; a < 52; a++)
+            for (int b = a + 1; b < 52; b++)
+                for (int c = b + 1; c < 52; c++)
+                    for (int d = c + 1; d < 52; d++)
+                        for (int e = d + 1; e < 52; e++) {
+                            CardSet board;
+                            for (int card : {a, b, c, d, e}) {
+                                board.add(Card::fromIndex(card));
+                            }
+                            boards.push_back(board);
+                        }
+        return boards;
+    }
+
+    double exactEquity(std::uint32_t matchup, const std::vector<CardSet>& boards) {
+        CardSet hero = CardSet(Card::fromIndex(matchup & 0xFF)) | CardSet(Card::fromIndex((matchup >> 8) & 0xFF));
+        CardSet opponent = CardSet(Card::fromIndex((matchup >> 16) & 0xFF)) |
+                           CardSet(Card::fromIndex((matchup >> 24) & 0xFF));
+        CardSet dead = hero | opponent;
+
+        std::array<CardSet, CHUNK> heroSets;
+        std::array<CardSet, CHUNK> opponentSets;
+        std::array<HandEvaluator::HandRank, CHUNK> heroRanks;
+        std::array<HandEvaluator::HandRank, CHUNK> opponentRanks;
+        std::uint64_t points = 0;
+        std::uint64_t total = 0;
+        std::size_t filled = 0;
+
+        auto flush = [&]() {
+            BatchEvaluator::evaluate(heroSets.data(), heroRanks.data(), filled);
+            BatchEvaluator::evaluate(opponentSets.data(), opponentRanks.data(), filled);
+            for (std::size_t i = 0; i < filled; i++) {
+                points += heroRanks[i] > opponentRanks[i] ? 2 : (heroRanks[i] == opponentRanks[i] ? 1 : 0);
+            }
+            total += filled;
+            filled = 0;
+        };
+
+        for (CardSet board : boards) {
+            if (board.intersects(dead)) {
+                continue;
+            }
+            heroSets[filled] = hero | board;
+            opponentSets[filled] = opponent | board;
+            if (++filled == CHUNK) {
+                flush();
+            }
+        }
+        flush();
+        return points / (2.0 * total);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <output header>" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::vector<int>> classCombos(NUM_CLASSES);
+    for (int combo = 0; combo < HoleCombos::NUM_COMBOS; combo++) {
+        classCombos[classOf(HoleCombos::firstCard(combo), HoleCombos::secondCard(combo))].push_back(combo);
+    }
+
+    std::vector<std::map<std::uint32_t, int>> matchupCounts(NUM_CLASSES * NUM_CLASSES);
+    std::unordered_map<std::uint32_t, double> equities;
+    for (int heroClass = 0; heroClass < NUM_CLASSES; heroClass++) {
+        for (int opponentClass = heroClass; opponentClass < NUM_CLASSES; opponentClass++) {
+            auto& counts = matchupCounts[heroClass * NUM_CLASSES + opponentClass];
+            for (int hero : classCombos[heroClass]) {
+                for (int opponent : classCombos[opponentClass]) {
+                    if (!HoleCombos::getMask(hero).intersects(HoleCombos::getMask(opponent))) {
+                        std::uint32_t key = canonicalMatchup(hero, opponent);
+                        counts[key]++;
+                        equities.emplace(key, 0.0);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> keys;
+    keys.reserve(equities.size());
+    for (const auto& entry : equities) {
+        keys.push_back(entry.first);
+    }
+    std::sort(keys.begin(), keys.end());
+    std::cerr << keys.size() << " distinct matchups" << std::endl;
+
+    const std::vector<CardSet> boards = allBoards();
+    std::vector<double> results(keys.size());
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> workers;
+    unsigned numThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t = 0; t < numThreads; t++) {
+        workers.emplace_back([&]() {
+            for (std::size_t i = next++; i < keys.size(); i = next++) {
+                results[i] = exactEquity(keys[i], boards);
+                if (i % 1000 == 0) {
+                    std::cerr << i << "/" << keys.size() << std::endl;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        equities[keys[i]] = results[i];
+    }
+
+    std::vector<double> table(NUM_CLASSES * NUM_CLASSES);
+    std::vector<double> randomPoints(NUM_CLASSES, 0.0);
+    std::vector<double> randomCounts(NUM_CLASSES, 0.0);
+    for (int heroClass = 0; heroClass < NUM_CLASSES; heroClass++) {
+        for (int opponentClass = heroClass; opponentClass < NUM_CLASSES; opponentClass++) {
+            double points = 0.0;
+            double count = 0.0;
+            for (const auto& entry : matchupCounts[heroClass * NUM_CLASSES + opponentClass]) {
+                points += entry.second * equities[entry.first];
+                count += entry.second;
+            }
+            double equity = points / count;
+            table[heroClass * NUM_CLASSES + opponentClass] = equity;
+            table[opponentClass * NUM_CLASSES + heroClass] = 1.0 - equity;
+            randomPoints[heroClass] += points;
+            randomCounts[heroClass] += count;
+            if (opponentClass != heroClass) {
+                randomPoints[opponentClass] += count - points;
+                randomCounts[opponentClass] += count;
+            }
+        }
+    }
+
+    std::ofstream out(argv[1]);
+    auto scaled = [](double equity) {
+        return static_cast<unsigned>(equity * 65535.0 + 0.5);
+    };
+    out << "#ifndef PREFLOP_EQUITY_TABLE_H\n#define PREFLOP_EQUITY_TABLE_H\n\n";
+    out << "// Generated by tools/preflop_table_gen.cpp. Do not edit by hand.\n";
+    out << "// Exact heads-up all-in equity of the row class against the column\n";
+    out << "// class, scaled by 65535. See preflop_equity.h for the class layout.\n\n";
+    out << "#include <cstdint>\n\n";
+    out << "namespace PreflopEquityTable {\n";
+    out << "    inline constexpr std::uint16_t EQUITY[169][169] = {\n";
+    for (int row = 0; row < NUM_CLASSES; row++) {
+        out << "        {";
+        for (int col = 0; col < NUM_CLASSES; col++) {
+            out << scaled(table[row * NUM_CLASSES + col]) << (col + 1 < NUM_CLASSES ? "," : "");
+        }
+        out << "}" << (row + 1 < NUM_CLASSES ? "," : "") << "\n";
+    }
+    out << "    };\n\n";
+    out << "    inline constexpr std::uint16_t VS_RANDOM[169] = {\n        ";
+    for (int row = 0; row < NUM_CLASSES; row++) {
+        out << scaled(randomPoints[row] / randomCounts[row]) << (row + 1 < NUM_CLASSES ? "," : "");
+        if (row % 13 == 12 && row + 1 < NUM_CLASSES) {
+            out << "\n        ";
+        }
+    }
+    out << "\n    };\n}\n\n#endif\n";
+    return 0;
+}
@@ -0,0 +1,271 @@
+// Stand-in dealer for the shared-memory transport. Creates the segment,
+// starts the bot, and deals it heads-up hands against a check/call
+// opponent (min-raising with probability --raise-rate) using the engine's
+// message format, then reports the per-action round-trip latency.
+//
+//   g++ -std=c++17 -O3 -march=native tools/shm_dealer.cpp -o shm_dealer
+//   ./shm_dealer --hands 100000 -- ./bot --shm /pokerbots
+//
+// Without a bot command the dealer waits for a bot to attach to --name.
+// Linux only.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../lib/engine/shm_transport.h"
+#include "../lib/engine/transport.h"
+#include "../lib/game/card.h"
+#include "../lib/game/compact_round_state.h"
+#include "../lib/game/game_constants.h"
+#include "../lib/game/poker_moves.h"
+#include "../lib/util/fast_rng.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string name = "/pokerbots";
+        int hands = GameConstants::NUM_ROUNDS;
+        double clock = 180.0;
+        std::uint64_t seed = 1;
+        double raiseRate = 0.0;
+        std::vector<char*> botCommand;
+    };
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--") {
+                options.botCommand.assign(argv + i + 1, argv + argc);
+                break;
+            }
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--name") {
+                options.name = value;
+            } else if (arg == "--hands") {
+                options.hands = std::stoi(value);
+            } else if (arg == "--clock") {
+                options.clock = std::stod(value);
+            } else if (arg == "--seed") {
+                options.seed = std::stoull(value);
+            } else if (arg == "--raise-rate") {
+                options.raiseRate = std::stod(value);
+            } else {
+                std::cerr << "Usage: shm_dealer [--name /NAME] [--hands N] [--clock S] [--seed N] [--raise-rate P] "
+                             "[-- BOT_COMMAND...]" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Engine half of the match: one message per bot decision, with every
+    // action (the bot's own included) echoed back, as the real engine does.
+    class Dealer {
+    private:
+        SharedMemoryTransport& transport;
+        ReceiveBuffer buffer;
+        std::string message;
+        std::vector<double> latencies;
+        double clock;
+        double raiseRate;
+        int bankroll;
+
+        void appendClause(std::string_view clause) {
+            if (!message.empty()) {
+                message += ' ';
+            }
+            message += clause;
+        }
+
+        // Sends the pending message and returns the bot's reply.
+        Move query() {
+            std::string outgoing = "T" + std::to_string(clock);
+            if (!message.empty()) {
+                outgoing += ' ';
+                outgoing += message;
+            }
+            outgoing += '\n';
+            message.clear();
+
+            const auto start = Clock::now();
+            transport.send(outgoing.data(), outgoing.size());
+            std::string_view line;
+            while (!buffer.nextLine(line)) {
+                if (!buffer.fill(transport)) {
+                    throw std::runtime_error("Bot closed the connection");
+                }
+            }
+            const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            latencies.push_back(elapsed);
+            clock -= elapsed;
+            return Move::decode(line);
+        }
+
+        static Move legalize(const CompactRoundState& state, Move move) {
+            const ActionOptions options = state.getActionOptions();
+            if (options.legal.contains(move.getType())) {
+                if (move.getType() != PokerMove::Type::RAISE ||
+                    (move.getAmount() >= options.raiseBounds[0] && move.getAmount() <= options.raiseBounds[1])) {
+                    return move;
+                }
+            }
+            return options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::fold();
+        }
+
+    public:
+        Dealer(SharedMemoryTransport& transport, double clock, double raiseRate)
+            : transport(transport), buffer(), clock(clock), raiseRate(raiseRate), bankroll(0) {}
+
+        void playHand(FastRng& rng, int seat, const std::array<int, 2>& bountyRanks) {
+            std::array<int, 52> deck;
+            for (int i = 0; i < 52; i++) {
+                deck[i] = i;
+            }
+            for (int i = 0; i < 9; i++) {
+                std::swap(deck[i], deck[i + static_cast<int>(rng.below(static_cast<std::uint32_t>(52 - i)))]);
+            }
+            std::array<Hand, 2> hands;
+            Board board;
+            for (int i = 0; i < 4; i++) {
+                hands[i / 2].push_back(Card(deck[i] / 4, deck[i] % 4));
+            }
+            for (int i = 4; i < 9; i++) {
+                board.push_back(Card(deck[i] / 4, deck[i] % 4));
+            }
+
+            CompactRoundState state = CompactRoundState::deal(hands, board, bountyRanks);
+            appendClause("P" + std::to_string(seat));
+            appendClause("H" + hands[seat].toString());
+            appendClause(std::string("G") + Card::rankToChar(bountyRanks[seat]));
+
+            while (!state.isTerminal()) {
+                const int street = state.getStreet();
+                Move move;
+                if (state.getActive() == seat) {
+                    move = legalize(state, query());
+                } else {
+                    const ActionOptions options = state.getActionOptions();
+                    if (options.legal.contains(PokerMove::Type::RAISE) && rng.uniform() < raiseRate) {
+                        move = Move::raise(options.raiseBounds[0]);
+                    } else {
+                        move = options.legal.contains(PokerMove::Type::CHECK) ? Move::check() : Move::call();
+                    }
+                }
+                appendClause(move.encode());
+                state = state.proceed(move);
+                if (!state.isTerminal() && state.getStreet() != street) {
+                    appendClause("B" + state.getBoard().toString());
+                }
+            }
+
+            if (state.getStatus() == CompactRoundState::Status::SHOWDOWN) {
+                appendClause("O" + hands[1 - seat].toString());
+            }
+            const int delta = state.getPayoffs()[seat];
+            const std::array<bool, 2> hits = state.getBountyHits();
+            bankroll += delta;
+            appendClause("D" + std::to_string(delta));
+            appendClause(std::string("Y") + (hits[seat] ? '1' : '0') + (hits[1 - seat] ? '1' : '0'));
+            query();
+        }
+
+        void quit() {
+            const char code[] = "Q\n";
+            transport.send(code, sizeof(code) - 1);
+            transport.close();
+        }
+
+        int getBankroll() const {
+            return bankroll;
+        }
+
+        std::vector<double>& getLatencies() {
+            return latencies;
+        }
+    };
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::unique_ptr<SharedMemoryTransport> transport;
+    std::unique_ptr<Dealer> dealer;
+    pid_t bot = -1;
+    bool botExited = false;
+    FastRng rng(options.seed);
+    std::array<int, 2> bountyRanks = {0, 0};
+    int played = 0;
+    auto start = Clock::now();
+    try {
+        transport = std::make_unique<SharedMemoryTransport>(options.name, SharedMemoryTransport::Role::DEALER);
+        if (!options.botCommand.empty()) {
+            options.botCommand.push_back(nullptr);
+            bot = fork();
+            if (bot == 0) {
+                execvp(options.botCommand[0], options.botCommand.data());
+                std::perror("execvp");
+                _exit(127);
+            }
+            // A bot that crashes, or never starts, cannot close its ring.
+            transport->watchPeer([bot, &botExited]() {
+                int status = 0;
+                botExited = botExited || waitpid(bot, &status, WNOHANG) == bot;
+                return !botExited;
+            });
+        } else {
+            std::cerr << "Waiting for a bot on " << options.name << std::endl;
+        }
+
+        dealer = std::make_unique<Dealer>(*transport, options.clock, options.raiseRate);
+        start = Clock::now();
+        for (int hand = 0; hand < options.hands; hand++) {
+            if (hand % GameConstants::ROUNDS_PER_BOUNTY == 0) {
+                bountyRanks = {static_cast<int>(rng.below(13)), static_cast<int>(rng.below(13))};
+            }
+            dealer->playHand(rng, hand % 2, bountyRanks);
+            played++;
+        }
+        dealer->quit();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+    }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (bot > 0 && !botExited) {
+        int status = 0;
+        waitpid(bot, &status, 0);
+    }
+    if (!dealer) {
+        return 1;
+    }
+
+    std::vector<double>& latencies = dealer->getLatencies();
+    if (latencies.empty()) {
+        return 1;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies[std::min(latencies.size() - 1, static_cast<std::size_t>(p * latencies.size()))] * 1e6;
+    };
+    std::cerr << played << " hands in " << elapsed << "s (" << played / elapsed * 3600.0
+              << " hands/hour), bot bankroll " << dealer->getBankroll() << std::endl;
+    std::cerr << latencies.size() << " round trips: median " << percentile(0.5) << "us, p99 " << percentile(0.99)
+              << "us, max " << latencies.back() * 1e6 << "us" << std::endl;
+    return 0;
+}
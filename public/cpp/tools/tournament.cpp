@@ -0,0 +1,224 @@
+// Round-robin self-play tournament between bot variants, run in-process on
+// every core with LocalMatch.
+//
+//   g++ -std=c++17 -O3 -march=native -pthread tools/tournament.cpp -o tournament
+//   ./tournament --bots tight:0.6,tight:0.55,random,checkcall --matches 40
+//
+// Each bot spec is NAME or NAME:PARAM; add your own strategies to
+// makeRegistry(). For every pairing it prints the first bot's bankroll,
+// bb/100 with a 95% confidence interval, and the bounty hits of both;
+// entrants are then ranked by their mean bb/100 over all opponents.
+// --duplicate replays every deal with the seats swapped, which narrows the
+// intervals for the same number of rounds. --aivat adds a luck-corrected
+// bb/100 and interval per pairing and ranks the entrants by it.
+// --sprt H0,H1 stops a pairing as soon as a sequential test decides between
+// win rates H0 and H1 (bb/100) at error rates --alpha and --beta; --matches
+// is then the most a pairing may play.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../lib/base/base_bot.h"
+#include "../lib/match/match_stats.h"
+#include "../lib/match/reference_bots.h"
+#include "../lib/match/tournament.h"
+
+namespace {
+    using Factory = std::function<std::unique_ptr<BaseBot>(const std::string& param, std::uint64_t seed)>;
+
+    std::map<std::string, Factory> makeRegistry() {
+        std::map<std::string, Factory> registry;
+        registry["checkcall"] = [](const std::string&, std::uint64_t) {
+            return std::make_unique<CheckCallBot>();
+        };
+        registry["minraise"] = [](const std::string&, std::uint64_t) {
+            return std::make_unique<MinRaiseBot>();
+        };
+        registry["random"] = [](const std::string& param, std::uint64_t seed) {
+            return std::make_unique<RandomBot>(seed, 0.1, param.empty() ? 0.2 : std::stod(param));
+        };
+        registry["tight"] = [](const std::string& param, std::uint64_t) {
+            return std::make_unique<TightBot>(param.empty() ? 0.6 : std::stod(param));
+        };
+        return registry;
+    }
+
+    struct Options {
+        std::vector<std::string> bots;
+        TournamentOptions tournament;
+    };
+
+    std::vector<std::string> split(const std::string& text, char separator) {
+        std::vector<std::string> parts;
+        std::size_t start = 0;
+        while (start <= text.size()) {
+            std::size_t end = text.find(separator, start);
+            if (end == std::string::npos) {
+                end = text.size();
+            }
+            if (end > start) {
+                parts.push_back(text.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+        return parts;
+    }
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--duplicate") {
+                options.tournament.duplicate = true;
+                continue;
+            }
+            if (arg == "--aivat") {
+                options.tournament.aivat = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--bots") {
+                options.bots = split(value, ',');
+            } else if (arg == "--matches") {
+                options.tournament.matchesPerPairing = std::stoi(value);
+            } else if (arg == "--rounds") {
+                options.tournament.rounds = std::stoi(value);
+            } else if (arg == "--threads") {
+                options.tournament.threads = static_cast<unsigned>(std::max(1, std::stoi(value)));
+            } else if (arg == "--seed") {
+                options.tournament.seed = std::stoull(value);
+            } else if (arg == "--sprt") {
+                std::vector<std::string> bounds = split(value, ',');
+                if (bounds.size() != 2) {
+                    std::cerr << "--sprt takes H0,H1" << std::endl;
+                    return false;
+                }
+                options.tournament.sprt = true;
+                options.tournament.sprtOptions.h0 = std::stod(bounds[0]);
+                options.tournament.sprtOptions.h1 = std::stod(bounds[1]);
+            } else if (arg == "--alpha") {
+                options.tournament.sprtOptions.alpha = std::stod(value);
+            } else if (arg == "--beta") {
+                options.tournament.sprtOptions.beta = std::stod(value);
+            } else {
+                std::cerr << "Usage: tournament --bots NAME[:PARAM],... [--matches N] [--rounds N] [--threads N] "
+                             "[--seed N] [--duplicate] [--aivat] [--sprt H0,H1 [--alpha P] [--beta P]]" << std::endl;
+                return false;
+            }
+        }
+        if (options.bots.size() < 2) {
+            std::cerr << "Need at least two bots" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    const std::map<std::string, Factory> registry = makeRegistry();
+    std::vector<Entrant> entrants;
+    for (const std::string& spec : options.bots) {
+        std::size_t colon = spec.find(':');
+        std::string name = spec.substr(0, colon);
+        std::string param = colon == std::string::npos ? "" : spec.substr(colon + 1);
+        auto found = registry.find(name);
+        if (found == registry.end()) {
+            std::cerr << "Unknown bot: " << name << std::endl;
+            return 1;
+        }
+        Factory factory = found->second;
+        entrants.push_back({spec, [factory, param](std::uint64_t seed) { return factory(param, seed); }});
+    }
+
+    Tournament tournament(entrants, options.tournament);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<PairingResult> pairings;
+    try {
+        pairings = tournament.run();
+    } catch (const std::exception& error) {
+        std::cerr << "Tournament failed: " << error.what() << std::endl;
+        return 1;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::int64_t totalRounds = 0;
+    int totalMatches = 0;
+    std::vector<double> scoreSum(entrants.size(), 0.0);
+    std::vector<int> opponents(entrants.size(), 0);
+    const bool aivat = options.tournament.aivat;
+    std::printf("%-16s %-16s %10s %9s %21s %13s", "first", "second", "bankroll", "bb/100", "95% CI", "bounty hits");
+    const bool sprt = options.tournament.sprt;
+    std::printf(aivat ? " %9s %21s" : "", "aivat", "95% CI");
+    std::printf(sprt ? " %7s %5s\n" : "\n", "matches", "sprt");
+    for (const PairingResult& pairing : pairings) {
+        const WinRate& winRate = pairing.winRate;
+        const auto interval = winRate.getConfidenceInterval();
+        std::printf("%-16s %-16s %10.0f %9.2f [%9.2f, %9.2f] %6d/%-6d", entrants[pairing.first].name.c_str(),
+                    entrants[pairing.second].name.c_str(), winRate.getTotal(), winRate.getBbPer100(), interval.first,
+                    interval.second, pairing.bountyHits[0], pairing.bountyHits[1]);
+        const WinRate& scored = aivat ? pairing.corrected : winRate;
+        if (aivat) {
+            const auto corrected = scored.getConfidenceInterval();
+            std::printf(" %9.2f [%9.2f, %9.2f]", scored.getBbPer100(), corrected.first, corrected.second);
+        }
+        if (sprt) {
+            const char* decision = pairing.decision == Sprt::Decision::ACCEPT_H1   ? "h1"
+                                   : pairing.decision == Sprt::Decision::ACCEPT_H0 ? "h0"
+                                                                                   : "-";
+            std::printf(" %7d %5s", pairing.matches, decision);
+        }
+        std::printf("\n");
+        totalMatches += pairing.matches;
+        totalRounds += winRate.getRounds();
+        // A pairing whose every match failed says nothing about either side.
+        if (pairing.matches == 0) {
+            continue;
+        }
+        scoreSum[pairing.first] += scored.getBbPer100();
+        scoreSum[pairing.second] -= scored.getBbPer100();
+        opponents[pairing.first]++;
+        opponents[pairing.second]++;
+    }
+    auto meanScore = [&](std::size_t index) {
+        return opponents[index] ? scoreSum[index] / opponents[index] : 0.0;
+    };
+
+    std::vector<std::size_t> order(entrants.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return meanScore(a) > meanScore(b);
+    });
+    std::printf("\n%-16s %12s\n", "entrant", "mean bb/100");
+    for (std::size_t index : order) {
+        std::printf("%-16s %12.2f\n", entrants[index].name.c_str(), meanScore(index));
+    }
+    int failedPairings = 0;
+    for (const PairingResult& pairing : pairings) {
+        if (pairing.failures > 0) {
+            failedPairings++;
+            std::cerr << entrants[pairing.first].name << " vs " << entrants[pairing.second].name << ": "
+                      << pairing.failures << " matches failed, first with: " << pairing.error << std::endl;
+        }
+    }
+    std::cerr << totalMatches << " of " << pairings.size() * options.tournament.matchesPerPairing << " matches, "
+              << totalRounds << " rounds in " << elapsed << "s (" << totalRounds / elapsed * 3600.0
+              << " rounds/hour on " << options.tournament.threads << " threads)" << std::endl;
+    return failedPairings > 0 ? 1 : 0;
+}